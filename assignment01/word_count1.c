@@ -1,9 +1,22 @@
 #include <stdio.h>
 #include <stdlib.h> // malloc, realloc, free, qsort
 #include <string.h> // strdup, strcmp
+#include <stddef.h> // offsetof
+
+#include "adt_heap.h"
+#include "tokenizer.h"
+#include "word_sort.h"
+#include "outbuf.h"
+#include "wc_stats.h"
 
 #define SORT_BY_WORD	0 // 단어 순 정렬
 #define SORT_BY_FREQ	1 // 빈도 순 정렬
+#define TOP_K_EXACT		2 // 빈도 상위 k개 (정확한 빈도)
+#define TOP_K_APPROX	3 // 빈도 상위 k개 (Space-Saving 근사, 메모리 O(k))
+
+#define INIT_CAPACITY	1000	// 배열의 초기 용량
+#define INIT_BUCKETS	2048	// 해시 테이블의 초기 슬롯 수 (2의 거듭제곱)
+#define EMPTY_SLOT		-1		// 비어있는 슬롯 표시
 
 // 구조체 선언
 // 단어 구조체
@@ -12,27 +25,131 @@ typedef struct {
 	int		freq;		// 빈도
 } tWord;
 
+// 해시 테이블 슬롯 구조체
+// 문자열을 다시 읽지 않도록 해시값을 함께 저장 (cached hash)
+typedef struct {
+	unsigned int	hash;	// 단어의 해시값
+	int				pos;	// data 배열에서의 인덱스 (EMPTY_SLOT이면 빈 슬롯)
+} tSlot;
+
+// Space-Saving 카운터 구조체
+// 추적 중인 단어의 추정 빈도 freq와 오차 err (실제 빈도는 freq - err 이상 freq 이하)
+typedef struct {
+	char			*word;		// 단어 (교체될 때 재사용하는 버퍼)
+	int				wcap;		// word 버퍼의 크기
+	unsigned int	hash;		// 단어의 해시값
+	int				freq;		// 추정 빈도
+	int				err;		// 최대 과대 추정치 (교체될 때의 최소 빈도)
+	int				heap_index;	// min-heap에서의 위치 (heap_Update에 사용)
+} tCounter;
+
+// Space-Saving 요약 구조체 (stream summary)
+// 카운터 k개를 min-heap(빈도 기준)으로 관리하고, 해시 테이블로 단어의 카운터를 찾음
+// 입력의 크기와 관계없이 메모리는 k에 비례
+typedef struct {
+	int			k;			// 카운터의 수
+	int			len;		// 사용 중인 카운터의 수
+	long		total;		// 지금까지 읽은 단어의 수
+	tCounter	*counters;
+	HEAP		*heap;		// 빈도가 가장 작은 카운터가 root
+	int			nbuckets;	// 해시 테이블의 슬롯 수 (2의 거듭제곱, 2k 이상)
+	int			*slots;		// 카운터 인덱스 (EMPTY_SLOT이면 빈 슬롯, linear probing)
+} tSummary;
+
 // 사전(dictionary) 구조체
+// data 배열은 입력 순서를 유지하고, slots는 data에 대한 해시 인덱스 역할
 typedef struct {
 	int		len;		// 배열에 저장된 단어의 수
 	int		capacity;	// 배열의 용량 (배열에 저장 가능한 단어의 수)
 	tWord	*data;		// 단어 구조체 배열에 대한 포인터
+	int		nbuckets;	// 해시 테이블의 슬롯 수 (2의 거듭제곱)
+	tSlot	*slots;		// open addressing 해시 테이블 (Robin Hood 방식)
 } tWordDic;
 
 ////////////////////////////////////////////////////////////////////////////////
 // 함수 원형 선언(declaration)
 
-// 단어를 사전에 저장
-// 새로 등장한 단어는 사전에 추가
-// 이미 사전에 존재하는(저장된) 단어는 해당 단어의 빈도를 갱신(update)
-// capacity는 1000으로부터 시작하여 1000씩 증가 (1000, 2000, 3000, ...)
+// 문자열의 해시값 계산 (FNV-1a)
+static unsigned int hash_word(const char *word) {
+	unsigned int h = 2166136261u;
+
+	while (*word) {
+		h ^= (unsigned char)*word++;
+		h *= 16777619u;
+	}
+	return h;
+}
+
+// 슬롯 i에 저장된 원소가 본래 위치(home)로부터 떨어진 거리 (probe sequence length)
+static int probe_distance(const tWordDic *dic, unsigned int hash, int i) {
+	return (i - (int)(hash & (dic->nbuckets - 1))) & (dic->nbuckets - 1);
+}
+
+// 해시 테이블에 (hash, pos)를 삽입 (Robin Hood hashing)
+// 본래 위치에서 더 멀리 떨어진 원소가 슬롯을 차지하도록 자리를 교환
+static void insert_slot(tWordDic *dic, unsigned int hash, int pos) {
+	int mask = dic->nbuckets - 1;
+	int i = hash & mask;
+	int dist = 0;
+
+	while (dic->slots[i].pos != EMPTY_SLOT) {
+		int d = probe_distance(dic, dic->slots[i].hash, i);
+
+		if (d < dist) { // 기존 원소가 더 가까우면 자리를 빼앗고, 밀려난 원소를 계속 삽입
+			tSlot tmp = dic->slots[i];
+			dic->slots[i].hash = hash;
+			dic->slots[i].pos = pos;
+			hash = tmp.hash;
+			pos = tmp.pos;
+			dist = d;
+		}
+		i = (i + 1) & mask;
+		dist++;
+	}
+	dic->slots[i].hash = hash;
+	dic->slots[i].pos = pos;
+}
+
+// 해시 테이블의 슬롯 수를 2배로 늘림
+// 저장된 해시값을 그대로 사용하므로 문자열을 다시 해싱하지 않음
+static void grow_slots(tWordDic *dic) {
+	tSlot *old = dic->slots;
+	int old_n = dic->nbuckets;
+
+	dic->nbuckets *= 2;
+	dic->slots = (tSlot *)malloc(dic->nbuckets * sizeof(tSlot));
+	if (dic->slots == NULL) {
+		fprintf(stderr, "Memory allocation error!\n");
+		exit(1);
+	}
+	for (int i = 0; i < dic->nbuckets; i++) {
+		dic->slots[i].pos = EMPTY_SLOT;
+	}
+	for (int i = 0; i < old_n; i++) {
+		if (old[i].pos != EMPTY_SLOT) {
+			insert_slot(dic, old[i].hash, old[i].pos);
+		}
+	}
+	free(old);
+}
+
 // 단어를 찾아 인덱스 반환
 // 단어가 존재하지 않으면 -1 반환
-int find_word(tWordDic *dic, const char *word) {
-	for (int i = 0; i < dic->len; i++) {
-		if (strcmp(dic->data[i].word, word) == 0) {
-			return i; // 단어를 찾은 경우 인덱스 반환
+// hash : 단어의 해시값 (hash_word)
+int find_word(tWordDic *dic, const char *word, unsigned int hash) {
+	int mask = dic->nbuckets - 1;
+	int i = hash & mask;
+
+	for (int dist = 0; dic->slots[i].pos != EMPTY_SLOT; dist++) {
+		STATS_CMP();
+
+		// Robin Hood 불변식: 현재 슬롯의 원소가 더 가까우면 찾는 단어는 없음
+		if (probe_distance(dic, dic->slots[i].hash, i) < dist) break;
+
+		if (dic->slots[i].hash == hash && strcmp(dic->data[dic->slots[i].pos].word, word) == 0) {
+			return dic->slots[i].pos; // 단어를 찾은 경우 인덱스 반환
 		}
+		i = (i + 1) & mask;
 	}
 	return -1; // 단어를 찾지 못한 경우 -1 반환
 }
@@ -40,19 +157,22 @@ int find_word(tWordDic *dic, const char *word) {
 // 단어를 사전에 저장
 // 새로 등장한 단어는 사전에 추가
 // 이미 사전에 존재하는(저장된) 단어는 해당 단어의 빈도를 갱신(update)
-// capacity는 1000으로부터 시작하여 1000씩 증가 (1000, 2000, 3000, ...)
-void word_count(FILE *fp, tWordDic *dic) {
-    char buffer[100]; // 단어를 읽을 버퍼
-    int freq; // 현재 단어의 빈도
+// capacity는 1000으로부터 시작하여 2배씩 증가 (1000, 2000, 4000, ...)
+void word_count(TOKENIZER *tok, tWordDic *dic) {
+    tToken token; // 입력 파일에서 읽은 단어 (TOK_CSTR이므로 '\0'으로 끝남)
+    const char *buffer;
     int index; // 사전에서 단어를 찾은 인덱스
+    unsigned int hash; // 현재 단어의 해시값
 
     // 단어를 사전에 저장
     // 새로 등장한 단어는 사전에 추가
     // 이미 사전에 존재하는(저장된) 단어는 해당 단어의 빈도를 갱신(update)
-    // capacity는 1000으로부터 시작하여 1000씩 증가 (1000, 2000, 3000, ...)
-    while (fscanf(fp, "%s %d", buffer, &freq) != EOF) {
+    while (tok_Next(tok, &token)) {
+        buffer = token.ptr;
+
         // 단어를 찾아 인덱스 반환
-        index = find_word(dic, buffer);
+        hash = hash_word(buffer);
+        index = find_word(dic, buffer, hash);
 
         // 단어가 이미 사전에 존재하는 경우
         if (index != -1) {
@@ -61,7 +181,7 @@ void word_count(FILE *fp, tWordDic *dic) {
         } else { // 단어가 새로운 경우
 			// 사전의 용량(capacity)을 확인하여 필요에 따라 확장
             if (dic->len >= dic->capacity) {
-                dic->capacity += 1000;
+                dic->capacity *= 2;
                 tWord *temp = realloc(dic->data, dic->capacity * sizeof(tWord));
                 if (temp == NULL) {
                     fprintf(stderr, "Memory allocation error!\n");
@@ -72,17 +192,31 @@ void word_count(FILE *fp, tWordDic *dic) {
             // 새로운 단어를 사전에 추가
             dic->data[dic->len].word = strdup(buffer);
             dic->data[dic->len].freq = 1;
+
+            // 해시 테이블에 등록 (load factor 7/8을 넘으면 확장)
+            if ((dic->len + 1) * 8 > dic->nbuckets * 7) {
+                grow_slots(dic);
+            }
+            insert_slot(dic, hash, dic->len);
             dic->len++; // 사전의 길이 증가
         }
     }
 }
 
 // 사전을 화면에 출력 ("단어\t빈도" 형식)
-void print_dic(tWordDic *dic){
-	for (int i = 0; i < dic->len; i++) {
-        printf("%s\t%d\n", dic->data[i].word, dic->data[i].freq);
+// n : 출력할 단어의 수 (앞에서부터)
+void print_dic(tWordDic *dic, int n){
+	OUTBUF *out = out_Stdout();
+
+	if (n > dic->len) n = dic->len;
+
+	for (int i = 0; i < n; i++) {
+        out_Str(out, dic->data[i].word);
+        out_Char(out, '\t');
+        out_Int(out, dic->data[i].freq);
+        out_Char(out, '\n');
     }
-    fflush(stdout); // 출력 버퍼 비우기
+    out_Flush(out); // 출력 버퍼 비우기
 }
 
 // 사전에 할당된 메모리를 해제
@@ -95,6 +229,9 @@ void destroy_dic(tWordDic *dic) {
     // 배열 해제
     free(dic->data);
 
+    // 해시 테이블 해제
+    free(dic->slots);
+
     // 사전 구조체 해제
     free(dic);
 }
@@ -126,64 +263,341 @@ int compare_by_freq(const void *n1, const void *n2) {
 }
 
 // 사전을 초기화 (빈 사전을 생성, 메모리 할당)
-// len를 0으로, capacity를 1000으로 초기화
+// len를 0으로, capacity를 1000으로, 해시 테이블을 빈 슬롯으로 초기화
 // return : 구조체 포인터
 tWordDic *create_dic(void)
 {
 	tWordDic *dic = (tWordDic *)malloc(sizeof(tWordDic));
 
 	dic->len = 0;
-	dic->capacity = 1000;
+	dic->capacity = INIT_CAPACITY;
 	dic->data = (tWord *)malloc(dic->capacity * sizeof(tWord));
 
+	dic->nbuckets = INIT_BUCKETS;
+	dic->slots = (tSlot *)malloc(dic->nbuckets * sizeof(tSlot));
+	for (int i = 0; i < dic->nbuckets; i++) {
+		dic->slots[i].pos = EMPTY_SLOT;
+	}
+
 	return dic;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
+// Space-Saving 근사 top-k (-k N --approx)
+// 카운터가 모두 사용 중일 때 새 단어가 나오면 빈도가 가장 작은 카운터를 빼앗고
+// 그 빈도를 오차(err)로 기록함
+// 빈도가 (전체 단어 수 / k)보다 큰 단어는 반드시 요약에 남아 있음
+
+// min-heap을 위한 비교 함수 (adt_heap은 compare가 큰 원소를 root로 둠)
+static int compare_counter(const void *n1, const void *n2) {
+	const tCounter *c1 = (const tCounter *)n1;
+	const tCounter *c2 = (const tCounter *)n2;
+
+	return (c1->freq < c2->freq) - (c1->freq > c2->freq);
+}
+
+// 카운터의 heap 위치 갱신 (indexed heap)
+static void set_counter_index(void *data, int index) {
+	((tCounter *)data)->heap_index = index;
+}
+
+// heap의 원소는 counters 배열이 소유하므로 heap_Destroy에서 해제하지 않음
+static void no_remove(void *ptr) {
+	(void)ptr;
+}
+
+// 요약을 초기화 (카운터 k개, 해시 테이블 슬롯 2k개 이상)
+// return : 구조체 포인터
+//          NULL if overflow
+tSummary *create_summary(int k) {
+	tSummary *sum = (tSummary *)malloc(sizeof(tSummary));
+
+	if (sum == NULL) return NULL;
+
+	sum->k = k;
+	sum->len = 0;
+	sum->total = 0;
+	sum->counters = (tCounter *)calloc(k, sizeof(tCounter));
+	sum->heap = heap_CreateIndexed(compare_counter, set_counter_index);
+
+	for (sum->nbuckets = INIT_BUCKETS; sum->nbuckets < 2 * k; sum->nbuckets *= 2)
+		;
+	sum->slots = (int *)malloc(sum->nbuckets * sizeof(int));
+
+	if (sum->counters == NULL || sum->heap == NULL || sum->slots == NULL) {
+		free(sum->counters);
+		free(sum->slots);
+		if (sum->heap != NULL) heap_Destroy(sum->heap, no_remove);
+		free(sum);
+		return NULL;
+	}
+	for (int i = 0; i < sum->nbuckets; i++) {
+		sum->slots[i] = EMPTY_SLOT;
+	}
+	return sum;
+}
+
+// 요약에 할당된 메모리를 해제
+void destroy_summary(tSummary *sum) {
+	for (int i = 0; i < sum->len; i++) {
+		free(sum->counters[i].word);
+	}
+	heap_Destroy(sum->heap, no_remove);
+	free(sum->counters);
+	free(sum->slots);
+	free(sum);
+}
+
+// 단어를 추적 중인 카운터를 찾아 슬롯 위치 반환
+// 단어가 없으면 -1 반환
+static int find_counter(tSummary *sum, const char *word, unsigned int hash) {
+	int mask = sum->nbuckets - 1;
+
+	for (int i = hash & mask; sum->slots[i] != EMPTY_SLOT; i = (i + 1) & mask) {
+		tCounter *c = &sum->counters[sum->slots[i]];
+
+		if (c->hash == hash && strcmp(c->word, word) == 0) return i;
+	}
+	return -1;
+}
+
+// 카운터 인덱스를 해시 테이블에 등록
+static void insert_counter_slot(tSummary *sum, int idx) {
+	int mask = sum->nbuckets - 1;
+	int i = sum->counters[idx].hash & mask;
+
+	while (sum->slots[i] != EMPTY_SLOT) {
+		i = (i + 1) & mask;
+	}
+	sum->slots[i] = idx;
+}
+
+// 슬롯 i를 비움 (backward shift deletion, tombstone을 남기지 않음)
+// 뒤따르는 원소 중 빈 슬롯 이전에 본래 위치가 있는 원소를 당겨옴
+static void delete_counter_slot(tSummary *sum, int i) {
+	int mask = sum->nbuckets - 1;
+	int j = i;
+
+	for (;;) {
+		j = (j + 1) & mask;
+		if (sum->slots[j] == EMPTY_SLOT) break;
+
+		int home = sum->counters[sum->slots[j]].hash & mask;
+
+		// home이 (i, j] 구간 밖에 있으면 j의 원소를 i로 옮길 수 있음
+		if (((j - home) & mask) >= ((j - i) & mask)) {
+			sum->slots[i] = sum->slots[j];
+			i = j;
+		}
+	}
+	sum->slots[i] = EMPTY_SLOT;
+}
+
+// 카운터의 단어를 바꿈 (버퍼가 작을 때만 다시 할당)
+static void set_counter_word(tCounter *c, const char *word, unsigned int hash) {
+	int len = strlen(word) + 1;
+
+	if (len > c->wcap) {
+		char *temp = realloc(c->word, len);
+		if (temp == NULL) {
+			fprintf(stderr, "Memory allocation error!\n");
+			exit(1);
+		}
+		c->word = temp;
+		c->wcap = len;
+	}
+	memcpy(c->word, word, len);
+	c->hash = hash;
+}
+
+// 입력의 모든 단어를 요약에 반영
+void word_count_approx(TOKENIZER *tok, tSummary *sum) {
+	tToken token;
+
+	while (tok_Next(tok, &token)) {
+		unsigned int hash = hash_word(token.ptr);
+		int slot = find_counter(sum, token.ptr, hash);
+		tCounter *c;
+
+		sum->total++;
+
+		if (slot != -1) { // 추적 중인 단어: 빈도 증가
+			c = &sum->counters[sum->slots[slot]];
+			c->freq++;
+		}
+		else if (sum->len < sum->k) { // 빈 카운터 사용
+			c = &sum->counters[sum->len];
+			set_counter_word(c, token.ptr, hash);
+			c->freq = 1;
+			c->err = 0;
+			insert_counter_slot(sum, sum->len++);
+			if (!heap_Insert(sum->heap, c)) {
+				fprintf(stderr, "Memory allocation error!\n");
+				exit(1);
+			}
+			continue;
+		}
+		else { // 빈도가 가장 작은 카운터를 새 단어로 교체
+			c = (tCounter *)heap_Top(sum->heap);
+			delete_counter_slot(sum, find_counter(sum, c->word, c->hash));
+			set_counter_word(c, token.ptr, hash);
+			c->err = c->freq;
+			c->freq++;
+			insert_counter_slot(sum, (int)(c - sum->counters));
+		}
+		heap_Update(sum->heap, c->heap_index);
+	}
+}
+
+// 정렬 기준 : 빈도 내림차순(1순위), 단어(2순위) (compare_by_freq와 같음)
+int compare_counter_by_freq(const void *n1, const void *n2) {
+	const tCounter *c1 = (const tCounter *)n1;
+	const tCounter *c2 = (const tCounter *)n2;
+
+	if (c1->freq != c2->freq) return (c1->freq < c2->freq) - (c1->freq > c2->freq);
+	return strcasecmp(c1->word, c2->word);
+}
+
+// 요약을 빈도순으로 출력 ("단어\t빈도\t오차" 형식)
+// heap은 더 이상 사용하지 않으므로 counters 배열을 직접 정렬
+void print_summary(tSummary *sum) {
+	OUTBUF *out = out_Stdout();
+
+	if (!wsort_ByFreq(sum->counters, sum->len, sizeof(tCounter), offsetof(tCounter, word), offsetof(tCounter, freq), WSORT_FOLDCASE))
+		qsort(sum->counters, sum->len, sizeof(tCounter), compare_counter_by_freq);
+
+	for (int i = 0; i < sum->len; i++) {
+		out_Str(out, sum->counters[i].word);
+		out_Char(out, '\t');
+		out_Int(out, sum->counters[i].freq);
+		out_Char(out, '\t');
+		out_Int(out, sum->counters[i].err);
+		out_Char(out, '\n');
+	}
+	out_Flush(out);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+#ifdef WC_STATS
+// 벤치마크: 입력의 모든 단어를 사전에서 다시 찾음
+// return	찾은 단어의 수 (입력의 단어 수)
+static long stats_lookup(const char *filename, tWordDic *dic) {
+	TOKENIZER *tok = tok_Open(filename, TOK_CSTR);
+	tToken token;
+	long n = 0;
+
+	if (tok == NULL) return 0;
+
+	STATS_BEGIN();
+	while (tok_Next(tok, &token)) {
+		STATS_SINK(find_word(dic, token.ptr, hash_word(token.ptr)));
+		n++;
+	}
+	STATS_END(STATS_LOOKUP, n);
+
+	tok_Close(tok);
+	return n;
+}
+#endif
+
 int main(int argc, char **argv)
 {
 	tWordDic *dic;
 	int option;
-	FILE *fp;
+	int k = 0; // -k N : 출력할 단어의 수
+	const char *filename;
+	TOKENIZER *tok;
 
-	if (argc != 3)
+	if (argc >= 4 && strcmp(argv[1], "-k") == 0)
 	{
-		fprintf(stderr, "Usage: %s option FILE\n\n", argv[0]);
+		k = atoi(argv[2]);
+		if (argc == 5 && strcmp(argv[3], "--approx") == 0)
+			option = TOP_K_APPROX;
+		else if (argc == 4)
+			option = TOP_K_EXACT;
+		else {
+			fprintf(stderr, "unknown option : %s\n", argv[3]);
+			return 1;
+		}
+		if (k <= 0) {
+			fprintf(stderr, "invalid number of words : %s\n", argv[2]);
+			return 1;
+		}
+		filename = argv[argc - 1];
+	}
+	else if (argc == 3)
+	{
+		if (strcmp(argv[1], "-n") == 0)
+			option = SORT_BY_WORD;
+		else if (strcmp(argv[1], "-f") == 0)
+			option = SORT_BY_FREQ;
+		else {
+			fprintf(stderr, "unknown option : %s\n", argv[1]);
+			return 1;
+		}
+		filename = argv[2];
+	}
+	else
+	{
+		fprintf(stderr, "Usage: %s option FILE\n", argv[0]);
+		fprintf(stderr, "       %s -k N [--approx] FILE\n\n", argv[0]);
 		fprintf(stderr, "option\n\t-n\t\tsort by word\n\t-f\t\tsort by frequency\n");
+		fprintf(stderr, "\t-k N\t\ttop N words by frequency\n");
+		fprintf(stderr, "\t-k N --approx\ttop N words in O(N) memory (Space-Saving)\n");
+		fprintf(stderr, "\t\t\toutput \"word\\tfreq\\terror\", true frequency is in [freq - error, freq]\n");
 		return 1;
 	}
 
-	if (strcmp(argv[1], "-n") == 0)
-		option = SORT_BY_WORD;
-	else if (strcmp(argv[1], "-f") == 0)
-		option = SORT_BY_FREQ;
-	else {
-		fprintf(stderr, "unknown option : %s\n", argv[1]);
+	// 입력 파일 열기 ("-"이면 표준 입력)
+	if ((tok = tok_Open(filename, TOK_CSTR)) == NULL)
+	{
+		fprintf(stderr, "cannot open file : %s\n", filename);
 		return 1;
 	}
 
-	// 사전 초기화
-	dic = create_dic();
+	// 근사 top-k: 사전 대신 크기 k의 요약만 유지
+	if (option == TOP_K_APPROX) {
+		tSummary *sum = create_summary(k);
 
-	// 입력 파일 열기
-	if ((fp = fopen(argv[2], "r")) == NULL)
-	{
-		fprintf(stderr, "cannot open file : %s\n", argv[2]);
-		return 1;
+		if (sum == NULL) {
+			fprintf(stderr, "Memory allocation error!\n");
+			return 1;
+		}
+		word_count_approx(tok, sum);
+		tok_Close(tok);
+
+		print_summary(sum);
+		destroy_summary(sum);
+		return 0;
 	}
 
+	// 사전 초기화
+	dic = create_dic();
+
 	// 입력 파일로부터 단어와 빈도를 사전에 저장
-	word_count(fp, dic);
+	STATS_BEGIN();
+	word_count(tok, dic);
+	STATS_END(STATS_BUILD, 0);
+
+	tok_Close(tok);
 
-	fclose(fp);
+#ifdef WC_STATS
+	STATS_OPS(STATS_BUILD, stats_lookup(filename, dic));
+#endif
 
 	// 정렬 (빈도 내림차순, 빈도가 같은 경우 단어순)
-	if (option == SORT_BY_FREQ) {
-		qsort(dic->data, dic->len, sizeof(tWord), compare_by_freq);
+	// compare_by_freq와 같은 순서를 radix pass + multikey quicksort로 정렬
+	// (메모리가 부족하면 qsort 사용)
+	if (option != SORT_BY_WORD) {
+		if (!wsort_ByFreq(dic->data, dic->len, sizeof(tWord), offsetof(tWord, word), offsetof(tWord, freq), WSORT_FOLDCASE))
+			qsort(dic->data, dic->len, sizeof(tWord), compare_by_freq);
 	}
 
 	// 사전을 화면에 출력
-	print_dic(dic);
+	STATS_BEGIN();
+	print_dic(dic, option == TOP_K_EXACT ? k : dic->len);
+	STATS_END(STATS_DUMP, dic->len);
+	STATS_REPORT(dic->len);
 
 	// 사전 메모리 해제
 	destroy_dic(dic);
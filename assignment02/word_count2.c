@@ -1,80 +1,294 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "adt_heap.h"
+#include "tokenizer.h"
+#include "word_sort.h"
+#include "word_key.h"
+#include "outbuf.h"
+#include "wc_stats.h"
 
 #define SORT_BY_WORD    0 // 단어 순 정렬
 #define SORT_BY_FREQ    1 // 빈도 순 정렬
-#define MAX_WORD_LEN    100 // 최대 단어 길이
+#define MAX_THREADS     64 // -j 옵션의 최대 스레드 수
+#define BLOCK_SIZE      256 // 블록 하나에 저장하는 최대 단어 수
+#define STREAM_EVERY    100000 // 스트리밍 모드의 기본 스냅샷 간격 (단어 수)
+#define MERGE_FANIN     64 // 외부 모드에서 한 번에 합치는 run 파일의 최대 수
 
 // 구조체 선언
 // 단어 구조체
+// key, len은 binary_search에서 단어 문자열을 읽지 않고 비교하기 위한 값
 typedef struct {
-    char    *word;      // 단어
-    int     freq;       // 빈도
+    char        *word;  // 단어
+    tWordKey    key;    // 단어의 앞 8바이트 (wkey_Make)
+    int         len;    // 단어의 길이
+    int         freq;   // 빈도
 } tWord;
 
+// 정렬된 블록
+// 새 단어를 삽입할 때 memmove하는 양은 블록 크기로 제한됨
+typedef struct {
+    int     len;                // 블록에 저장된 단어의 수
+    tWord   data[BLOCK_SIZE];   // 단어순으로 정렬된 단어 구조체 배열
+} tBlock;
+
 // 사전(dictionary) 구조체
+// 단어를 셀 때는 정렬된 블록들에 저장하고 (blocks, fence)
+// 다 센 뒤에는 flatten_dic으로 하나의 정렬된 배열(data)로 펼침
 typedef struct {
-    int     len;        // 배열에 저장된 단어의 수
-    int     capacity;   // 배열의 용량 (배열에 저장 가능한 단어의 수)
-    tWord   *data;      // 단어 구조체 배열에 대한 포인터
+    int     len;        // 사전에 저장된 단어의 수
+    int     nblocks;    // 블록의 수
+    int     capacity;   // 블록 포인터 배열의 용량
+    tBlock  **blocks;   // 단어순으로 정렬된 블록 배열
+    tWord   *fence;     // 각 블록의 첫 단어의 복사본 (블록을 찾기 위한 상위 인덱스, freq는 사용하지 않음)
+    tWord   *data;      // 단어 구조체 배열에 대한 포인터 (flatten_dic 이후)
 } tWordDic;
 
+// 스레드별 작업 구조체 (-j 옵션)
+typedef struct {
+    const char  *filename;  // 입력 파일
+    off_t       start;      // 담당 구간의 시작 (파일 오프셋)
+    off_t       end;        // 담당 구간의 끝
+    tWordDic    *dic;       // 스레드 지역 사전
+    int         ok;         // 1: 성공, 0: 파일 열기 실패
+} tChunk;
+
+// 스트리밍 모드 상태 (-s 옵션)
+// 스냅샷 사이에 빈도가 바뀐 단어만 dirty에 모아 두고,
+// 스냅샷은 dirty 단어와 직전 상위 목록(top)만 다시 정렬함
+typedef struct {
+    int     option;     // 출력 순서 (SORT_BY_WORD, SORT_BY_FREQ)
+    int     topk;       // 0: 바뀐 단어만 출력, >0: 빈도 상위 topk개 출력
+    long    every;      // 스냅샷 간격 (단어 수, 0이면 사용하지 않음)
+    long    tokens;     // 지금까지 읽은 단어 수
+    long    last;       // 직전 스냅샷까지 읽은 단어 수
+    int     seq;        // 스냅샷 번호
+    char    **dirty;    // 직전 스냅샷 이후 빈도가 바뀐 단어 (사전의 단어 문자열)
+    int     *dirty_slot;// dirty[i]가 저장된 dset의 슬롯 (스냅샷 후 그 슬롯만 비움)
+    int     ndirty;
+    int     dirty_cap;  // dirty 배열의 용량 (dset 슬롯 수의 절반)
+    char    **dset;     // dirty 단어의 집합 (포인터에 대한 open addressing, NULL이면 빈 슬롯)
+    tWord   *top;       // 직전 스냅샷의 상위 topk개 (빈도순)
+    int     ntop;
+} tStream;
+
+// 외부 모드의 run 파일들 (-m 옵션)
+// 메모리 예산만큼 센 사전(또는 빈도순 레코드)을 정렬된 "word\tfreq" 파일로 내보낸 것
+typedef struct {
+    char    dir[256];   // run 파일을 저장하는 임시 디렉토리
+    int     next;       // 다음 run 파일 번호
+    int     n;          // 남아 있는 run 파일의 수
+    int     cap;
+    char    **files;    // run 파일 경로
+} tRuns;
+
+// run 파일을 읽는 상태 (k-way merge의 heap 원소)
+typedef struct {
+    TOKENIZER   *tok;
+    tWord       cur;        // 현재 레코드 (word는 tokenizer 버퍼를 가리키며 '\0'으로 끝나지 않음)
+    int         heap_index; // heap에서의 위치 (heap_Update에 사용)
+} tRunReader;
+
+// 빈도순 외부 정렬 (-f): 단어순 merge 결과를 메모리 예산만큼 모아 빈도순으로 정렬한 run 파일로 내보냄
+typedef struct {
+    tRuns   *runs;      // 빈도순 run 파일
+    size_t  budget;     // 메모리 예산 (bytes)
+    tWord   *recs;      // 레코드 (word는 strs를 가리키는 오프셋으로 저장한 뒤 내보낼 때 포인터로 바꿈)
+    int     n;
+    int     cap;
+    char    *strs;      // 단어 문자열 버퍼
+    size_t  used;
+    size_t  strs_cap;
+} tFreqSpill;
+
 // 함수 원형 선언
-void word_count(FILE *fp, tWordDic *dic);
+void word_count(TOKENIZER *tok, tWordDic *dic);
 void print_dic(tWordDic *dic);
 void destroy_dic(tWordDic *dic);
 int compare_by_word(const void *n1, const void *n2);
 int compare_by_freq(const void *n1, const void *n2);
-int binary_search(const char *key, const tWord *base, int nmemb, int *found);
+int binary_search(const tWord *key, const tWord *base, int nmemb, int *found);
+tWordDic *create_dic(void);
+void flatten_dic(tWordDic *dic);
+tWordDic *merge_dics(tWordDic *parts[], int k);
+tWordDic *word_count_parallel(const char *filename, int nthreads);
 
-// 단어를 사전에 저장
-void word_count(FILE *fp, tWordDic *dic) {
-    char word[MAX_WORD_LEN];
+// 두 단어 구조체를 단어순으로 비교 (앞 8바이트 키를 먼저 비교)
+// return   strcmp와 같은 부호
+static inline int word_cmp(const tWord *w1, const tWord *w2) {
+    STATS_CMP();
+    return wkey_Compare(w1->key, w1->word, w1->len, w2->key, w2->word, w2->len);
+}
 
-    while (fscanf(fp, "%s", word) != EOF) {
-        int found = 0;
-        int index = binary_search(word, dic->data, dic->len, &found);
+// 단어가 들어갈 블록을 찾음 (fence에 대한 이진탐색)
+// return   첫 단어가 key보다 크지 않은 마지막 블록의 인덱스 (없으면 0)
+static int find_block(const tWordDic *dic, const tWord *key) {
+    int left = 1;
+    int right = dic->nblocks - 1;
+    int b = 0;
 
-        if (found) {
-            // 이미 있는 단어의 빈도를 증가
-            (dic->data + index)->freq++;
+    while (left <= right) {
+        int mid = (left + right) / 2;
+        if (word_cmp(&dic->fence[mid], key) <= 0) {
+            b = mid;
+            left = mid + 1;
         } else {
-            // 새로운 단어를 추가
-            if (dic->len >= dic->capacity) {
-                // 사전의 용량이 부족할 경우 용량을 늘림
-                dic->capacity += 1000;
-                dic->data = (tWord *)realloc(dic->data, dic->capacity * sizeof(tWord));
-            }
-            // 삽입할 위치부터의 데이터들을 이동시킴
-            memmove(dic->data + index + 1, dic->data + index, (dic->len - index) * sizeof(tWord));
-            // 새로운 단어 삽입
-            (dic->data + index)->word = strdup(word); 
-            (dic->data + index)->freq = 1; //빈도 업데이트
-            dic->len++; //배열에 저장된 단어 수 1 증가
+            right = mid - 1;
         }
     }
+    return b;
+}
+
+// b번째 블록의 half번째 이후 단어들을 새 블록으로 옮겨 b+1번째에 삽입
+// half가 BLOCK_SIZE이면 빈 블록을 추가 (정렬된 입력에서 블록을 가득 채움)
+static void split_block(tWordDic *dic, int b, int half) {
+    tBlock *block = dic->blocks[b];
+    tBlock *newBlock = (tBlock *)malloc(sizeof(tBlock));
+
+    if (dic->nblocks >= dic->capacity) {
+        // 블록 포인터 배열의 용량이 부족할 경우 용량을 늘림
+        dic->capacity *= 2;
+        dic->blocks = (tBlock **)realloc(dic->blocks, dic->capacity * sizeof(tBlock *));
+        dic->fence = (tWord *)realloc(dic->fence, dic->capacity * sizeof(tWord));
+    }
+
+    newBlock->len = block->len - half;
+    memcpy(newBlock->data, block->data + half, newBlock->len * sizeof(tWord));
+    block->len = half;
+
+    memmove(dic->blocks + b + 2, dic->blocks + b + 1, (dic->nblocks - b - 1) * sizeof(tBlock *));
+    memmove(dic->fence + b + 2, dic->fence + b + 1, (dic->nblocks - b - 1) * sizeof(tWord));
+    dic->blocks[b + 1] = newBlock;
+    // 빈 블록의 fence는 첫 단어가 삽입될 때 설정됨
+    if (newBlock->len > 0) dic->fence[b + 1] = newBlock->data[0];
+    dic->nblocks++;
+}
+
+// 단어 하나를 사전에 저장 (word는 len 바이트)
+// 새로운 단어는 추가하고, 이미 있는 단어는 빈도를 증가
+// return   사전에 저장된 단어 문자열 (사전을 해제할 때까지 주소가 바뀌지 않음)
+static inline char *add_word(tWordDic *dic, const char *word, int len) {
+    tWord key;
+    int found = 0;
+    int b;
+    tBlock *block;
+    int index;
+
+    key.word = (char *)word;
+    key.len = len;
+    key.key = wkey_Make(word, len);
+
+    b = find_block(dic, &key);
+    block = dic->blocks[b];
+    index = binary_search(&key, block->data, block->len, &found);
+
+    if (found) {
+        // 이미 있는 단어의 빈도를 증가
+        (block->data + index)->freq++;
+        return (block->data + index)->word;
+    }
+
+    // 새로운 단어를 추가
+    if (block->len == BLOCK_SIZE) {
+        // 블록이 가득 찬 경우 블록을 나눔
+        // 마지막 블록의 끝에 추가하는 경우에는 빈 블록을 새로 만듦
+        int half = (b == dic->nblocks - 1 && index == BLOCK_SIZE) ? BLOCK_SIZE : BLOCK_SIZE / 2;
+
+        split_block(dic, b, half);
+        if (index >= half) {
+            b++;
+            index -= half;
+            block = dic->blocks[b];
+        }
+    }
+    // 삽입할 위치부터의 데이터들을 이동시킴 (블록 안에서만)
+    memmove(block->data + index + 1, block->data + index, (block->len - index) * sizeof(tWord));
+    // 새로운 단어 삽입
+    (block->data + index)->word = (char *)malloc(len + 1); // word는 '\0'으로 끝나지 않을 수 있음 (외부 모드)
+    memcpy((block->data + index)->word, word, len);
+    (block->data + index)->word[len] = '\0';
+    (block->data + index)->key = key.key;
+    (block->data + index)->len = key.len;
+    (block->data + index)->freq = 1; //빈도 업데이트
+    block->len++;
+    dic->len++; //사전에 저장된 단어 수 1 증가
+
+    if (index == 0) dic->fence[b] = block->data[0];
+
+    return (block->data + index)->word;
+}
+
+// 단어를 사전에 저장
+void word_count(TOKENIZER *tok, tWordDic *dic) {
+    tToken token;
+
+    while (tok_Next(tok, &token)) {
+        add_word(dic, token.ptr, (int)token.len); // TOK_CSTR이므로 '\0'으로 끝남
+    }
+}
+
+// 블록들을 하나의 정렬된 배열(data)로 펼치고 블록을 해제
+// 이후 print_dic, qsort, merge_dics는 data 배열을 사용
+void flatten_dic(tWordDic *dic) {
+    int k = 0;
+
+    dic->data = (tWord *)malloc((dic->len > 0 ? dic->len : 1) * sizeof(tWord));
+
+    for (int b = 0; b < dic->nblocks; b++) {
+        memcpy(dic->data + k, dic->blocks[b]->data, dic->blocks[b]->len * sizeof(tWord));
+        k += dic->blocks[b]->len;
+        free(dic->blocks[b]);
+    }
+    free(dic->blocks);
+    free(dic->fence);
+    dic->blocks = NULL;
+    dic->fence = NULL;
+    dic->nblocks = 0;
+    dic->capacity = 0;
 }
 
 // 사전을 화면에 출력
 void print_dic(tWordDic *dic) {
+    OUTBUF *out = out_Stdout();
+
     for (int i = 0; i < dic->len; i++) {
-        printf("%s\t%d\n", dic->data[i].word, dic->data[i].freq); //(dic->data+i)->word와 동일
+        out_Write(out, dic->data[i].word, dic->data[i].len); //(dic->data+i)->word와 동일
+        out_Char(out, '\t');
+        out_Int(out, dic->data[i].freq);
+        out_Char(out, '\n');
     }
+    out_Flush(out);
 }
 
 // 사전에 할당된 메모리를 해제
 void destroy_dic(tWordDic *dic) {
-    for (int i = 0; i < dic->len; i++) {
-        free(dic->data[i].word);
+    if (dic->data) {
+        for (int i = 0; i < dic->len; i++) {
+            free(dic->data[i].word);
+        }
+        free(dic->data);
+    }
+    for (int b = 0; b < dic->nblocks; b++) {
+        for (int i = 0; i < dic->blocks[b]->len; i++) {
+            free(dic->blocks[b]->data[i].word);
+        }
+        free(dic->blocks[b]);
     }
-    free(dic->data);
+    free(dic->blocks);
+    free(dic->fence);
     free(dic);
 }
 
 // qsort를 위한 비교 함수 (정렬 기준: 단어)
 int compare_by_word(const void *n1, const void *n2) {
-    return strcmp(((tWord *)n1)->word, ((tWord *)n2)->word);
+    return word_cmp((const tWord *)n1, (const tWord *)n2);
 }
 
 // qsort를 위한 비교 함수 (정렬 기준: 빈도 내림차순)
@@ -88,13 +302,14 @@ int compare_by_freq(const void *n1, const void *n2) {
 }
 
 // 이진탐색 함수
-int binary_search(const char *key, const tWord *base, int nmemb, int *found) {
+// 대부분의 단계는 key->key와 (base + mid)->key의 정수 비교로 결정됨
+int binary_search(const tWord *key, const tWord *base, int nmemb, int *found) {
     int left = 0;
     int right = nmemb - 1;
 
     while (left <= right) {
         int mid = (left + right) / 2;
-        int cmp = strcmp(key, (base + mid)->word);
+        int cmp = word_cmp(key, base + mid);
         if (cmp == 0) {
             *found = 1;
             return mid;
@@ -109,23 +324,828 @@ int binary_search(const char *key, const tWord *base, int nmemb, int *found) {
     return left;
 }
 
-// 사전을 초기화 (빈 사전을 생성, 메모리 할당)
+// 사전을 초기화 (빈 블록 하나로 빈 사전을 생성, 메모리 할당)
 tWordDic *create_dic(void) {
     tWordDic *dic = (tWordDic *)malloc(sizeof(tWordDic));
     dic->len = 0;
-    dic->capacity = 1000;
-    dic->data = (tWord *)malloc(dic->capacity * sizeof(tWord));
+    dic->nblocks = 1;
+    dic->capacity = 16;
+    dic->blocks = (tBlock **)malloc(dic->capacity * sizeof(tBlock *));
+    dic->fence = (tWord *)malloc(dic->capacity * sizeof(tWord));
+    dic->blocks[0] = (tBlock *)malloc(sizeof(tBlock));
+    dic->blocks[0]->len = 0;
+    memset(&dic->fence[0], 0, sizeof(tWord));
+    dic->data = NULL;
     return dic;
 }
 
+// 부분 사전을 읽는 상태 (merge_dics의 heap 원소)
+typedef struct {
+    tWordDic    *dic;
+    int         pos;        // 현재 단어의 위치 (dic->data[pos])
+    int         heap_index; // heap에서의 위치 (heap_Update에 사용)
+} tDicRun;
+
+// min-heap을 위한 비교 함수 (adt_heap은 compare가 큰 원소를 root로 둠)
+// for merge_dics function
+// 정렬 기준 : 단어
+static int compare_dicrun_by_word(const void *n1, const void *n2) {
+    const tDicRun *r1 = (const tDicRun *)n1;
+    const tDicRun *r2 = (const tDicRun *)n2;
+
+    return word_cmp(&r2->dic->data[r2->pos], &r1->dic->data[r1->pos]);
+}
+
+// 부분 사전의 heap 위치 갱신 (indexed heap)
+// for merge_dics function
+static void set_dicrun_index(void *data, int index) {
+    ((tDicRun *)data)->heap_index = index;
+}
+
+// 단어순으로 정렬된 k개의 사전(flatten_dic 이후)을 하나의 사전으로 합침 (k-way merge)
+// 같은 단어는 빈도를 합산하고, 중복된 단어 문자열은 해제
+// 부분 사전의 data 배열은 합친 뒤 비워짐 (len = 0)
+tWordDic *merge_dics(tWordDic *parts[], int k) {
+    tWordDic *dic = create_dic();
+    HEAP *heap = heap_CreateIndexed(compare_dicrun_by_word, set_dicrun_index);
+    tDicRun runs[MAX_THREADS];
+    int total = 0;
+
+    for (int i = 0; i < k; i++) total += parts[i]->len;
+
+    // 빈 사전을 배열 형태로 바꾼 뒤 모든 단어를 담을 수 있도록 늘림
+    flatten_dic(dic);
+    if (total > 1) dic->data = (tWord *)realloc(dic->data, total * sizeof(tWord));
+
+    // 비어있지 않은 부분 사전으로 최소 힙 구성
+    for (int i = 0; i < k; i++) {
+        runs[i].dic = parts[i];
+        runs[i].pos = 0;
+        if (parts[i]->len > 0) heap_Insert(heap, &runs[i]);
+    }
+
+    while (!heap_Empty(heap)) {
+        tDicRun *r = (tDicRun *)heap_Top(heap);
+        tWord *cur = &r->dic->data[r->pos];
+
+        if (dic->len > 0 && word_cmp(&dic->data[dic->len - 1], cur) == 0) {
+            dic->data[dic->len - 1].freq += cur->freq; // 이미 합쳐진 단어
+            free(cur->word);
+        } else {
+            dic->data[dic->len++] = *cur;
+        }
+
+        // 부분 사전의 다음 단어로 root를 바꾸고, 부분 사전이 끝나면 heap에서 제거
+        if (++r->pos < r->dic->len) {
+            heap_Update(heap, 0);
+        } else {
+            void *done;
+            heap_Delete(heap, &done);
+        }
+    }
+    heap_Destroy(heap, NULL); // heap은 비어 있음 (원소는 runs 배열이 소유)
+
+    for (int i = 0; i < k; i++) parts[i]->len = 0;
+
+    return dic;
+}
+
+// 스레드 함수: 담당 구간의 단어를 스레드 지역 사전에 저장
+static void *count_chunk(void *arg) {
+    tChunk *chunk = (tChunk *)arg;
+    TOKENIZER *tok = tok_OpenRange(chunk->filename, TOK_CSTR, chunk->start, chunk->end);
+
+    chunk->ok = (tok != NULL);
+    if (tok) {
+        word_count(tok, chunk->dic);
+        tok_Close(tok);
+        flatten_dic(chunk->dic);
+    }
+    return NULL;
+}
+
+// 입력 파일을 구분자 경계에서 nthreads개의 구간으로 나누어 병렬로 단어를 세고
+// 스레드별 사전을 k-way merge하여 반환
+// return   단어순으로 정렬된 사전
+//          NULL if the file cannot be opened
+tWordDic *word_count_parallel(const char *filename, int nthreads) {
+    off_t bounds[MAX_THREADS + 1];
+    pthread_t tid[MAX_THREADS];
+    tChunk chunks[MAX_THREADS];
+    tWordDic *parts[MAX_THREADS];
+    tWordDic *dic = NULL;
+    int ok = 1;
+
+    if (!tok_Split(filename, nthreads, bounds)) return NULL;
+
+    for (int i = 0; i < nthreads; i++) {
+        chunks[i].filename = filename;
+        chunks[i].start = bounds[i];
+        chunks[i].end = bounds[i + 1];
+        chunks[i].dic = parts[i] = create_dic();
+        pthread_create(&tid[i], NULL, count_chunk, &chunks[i]);
+    }
+
+    for (int i = 0; i < nthreads; i++) {
+        pthread_join(tid[i], NULL);
+        if (!chunks[i].ok) ok = 0;
+    }
+
+    if (ok) dic = merge_dics(parts, nthreads);
+
+    for (int i = 0; i < nthreads; i++) destroy_dic(parts[i]);
+
+    return dic;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// 외부 모드 (-m 옵션)
+// 메모리 예산을 넘지 않도록 입력을 여러 run으로 나누어 세고, 각 run을 단어순 "word\tfreq" 파일로 내보낸 뒤
+// adt_heap으로 k-way merge하여 -n 결과를 만듦
+// -f 결과는 merge 결과를 다시 빈도순 run으로 나누어 정렬한 뒤 한 번 더 merge함 (외부 정렬 2단계)
+// run 파일은 OUTBUF로 순차적으로 쓰고 tokenizer로 순차적으로 읽음
+
+// run 파일 목록 초기화 (임시 디렉토리 생성)
+// return   1 if successful
+//          0 if the directory cannot be created
+static int runs_init(tRuns *runs) {
+    const char *tmp = getenv("TMPDIR");
+
+    snprintf(runs->dir, sizeof(runs->dir), "%s/wc2.XXXXXX", tmp ? tmp : "/tmp");
+    if (mkdtemp(runs->dir) == NULL) return 0;
+
+    runs->next = 0;
+    runs->n = 0;
+    runs->cap = 16;
+    runs->files = (char **)malloc(runs->cap * sizeof(char *));
+    return runs->files != NULL;
+}
+
+// 남은 run 파일과 임시 디렉토리를 삭제
+static void runs_destroy(tRuns *runs) {
+    for (int i = 0; i < runs->n; i++) {
+        unlink(runs->files[i]);
+        free(runs->files[i]);
+    }
+    free(runs->files);
+    rmdir(runs->dir);
+}
+
+// 새 run 파일을 만들어 목록에 추가
+// return   writer (파일을 다 쓴 뒤 out_Close)
+//          NULL if the file cannot be created
+static OUTBUF *runs_create(tRuns *runs) {
+    char path[300];
+
+    if (runs->n == runs->cap) {
+        runs->cap *= 2;
+        runs->files = (char **)realloc(runs->files, runs->cap * sizeof(char *));
+    }
+    snprintf(path, sizeof(path), "%s/run%06d", runs->dir, runs->next++);
+    runs->files[runs->n++] = strdup(path);
+
+    return out_Create(path, 0);
+}
+
+// 레코드 하나를 "word\tfreq" 형식으로 출력
+static void write_record(OUTBUF *out, const char *word, int len, int freq) {
+    out_Write(out, word, len);
+    out_Char(out, '\t');
+    out_Int(out, freq);
+    out_Char(out, '\n');
+}
+
+// 사전을 단어순 run 파일로 내보내고 해제
+// return   1 if successful
+//          0 if the file cannot be written
+static int spill_dic(tRuns *runs, tWordDic *dic) {
+    OUTBUF *out = runs_create(runs);
+    int ok;
+
+    if (out == NULL) {
+        destroy_dic(dic);
+        return 0;
+    }
+
+    // 블록은 이미 단어순이므로 정렬 없이 순서대로 씀
+    for (int b = 0; b < dic->nblocks; b++) {
+        for (int i = 0; i < dic->blocks[b]->len; i++) {
+            tWord *w = &dic->blocks[b]->data[i];
+            write_record(out, w->word, w->len, w->freq);
+        }
+    }
+    ok = out_Close(out);
+    destroy_dic(dic);
+
+    return ok;
+}
+
+// min-heap을 위한 비교 함수 (adt_heap은 compare가 큰 원소를 root로 둠)
+// 정렬 기준 : 단어
+static int compare_run_by_word(const void *n1, const void *n2) {
+    return word_cmp(&((const tRunReader *)n2)->cur, &((const tRunReader *)n1)->cur);
+}
+
+// 정렬 기준 : 빈도 내림차순, 단어
+static int compare_run_by_freq(const void *n1, const void *n2) {
+    return compare_by_freq(&((const tRunReader *)n2)->cur, &((const tRunReader *)n1)->cur);
+}
+
+// run reader의 heap 위치 갱신 (indexed heap)
+static void set_run_index(void *data, int index) {
+    ((tRunReader *)data)->heap_index = index;
+}
+
+// run 파일의 다음 레코드를 읽음
+// return   1 if successful
+//          0 end of file
+static int run_next(tRunReader *r) {
+    tToken token;
+    int freq;
+
+    if (!tok_NextRecord(r->tok, &token, &freq)) return 0;
+
+    r->cur.word = (char *)token.ptr;
+    r->cur.len = (int)token.len;
+    r->cur.key = wkey_Make(token.ptr, token.len);
+    r->cur.freq = freq;
+    return 1;
+}
+
+// merge 결과를 받는 함수 (단어순 merge에서는 같은 단어의 빈도를 합친 뒤 호출)
+typedef void (*tRecordSink)(void *arg, const char *word, int len, int freq);
+
+// run 파일 files[0..n-1]을 k-way merge
+// by_freq == 0 : 단어순 run, 같은 단어는 빈도를 합산
+// by_freq == 1 : 빈도순 run (단어는 중복되지 않음)
+// return   1 if successful
+//          0 if a run file cannot be opened
+static int merge_runs(char **files, int n, int by_freq, tRecordSink sink, void *arg) {
+    HEAP *heap = heap_CreateIndexed(by_freq ? compare_run_by_freq : compare_run_by_word, set_run_index);
+    tRunReader *readers = (tRunReader *)calloc(n, sizeof(tRunReader));
+    char *prev = NULL;      // 단어순 merge: 아직 내보내지 않은 단어 (run reader의 버퍼는 다음 레코드를 읽으면 바뀜)
+    int prev_len = 0, prev_cap = 0, prev_freq = 0;
+    int have_prev = 0;
+    int ok = 1;
+
+    for (int i = 0; i < n; i++) {
+        // TOK_CSTR 없이 읽기 전용으로 매핑 (페이지를 복사하지 않으므로 run 크기만큼 메모리를 쓰지 않음)
+        readers[i].tok = tok_Open(files[i], 0);
+        if (readers[i].tok == NULL) {
+            ok = 0;
+            continue;
+        }
+        if (run_next(&readers[i])) heap_Insert(heap, &readers[i]);
+    }
+
+    while (ok && !heap_Empty(heap)) {
+        tRunReader *r = (tRunReader *)heap_Top(heap);
+
+        if (by_freq) {
+            sink(arg, r->cur.word, r->cur.len, r->cur.freq);
+        } else if (have_prev && r->cur.len == prev_len && memcmp(r->cur.word, prev, prev_len) == 0) {
+            prev_freq += r->cur.freq; // 다른 run에 있는 같은 단어
+        } else {
+            if (have_prev) sink(arg, prev, prev_len, prev_freq);
+            if (r->cur.len + 1 > prev_cap) {
+                prev_cap = (r->cur.len + 1) * 2;
+                prev = (char *)realloc(prev, prev_cap);
+            }
+            memcpy(prev, r->cur.word, r->cur.len);
+            prev[r->cur.len] = '\0';
+            prev_len = r->cur.len;
+            prev_freq = r->cur.freq;
+            have_prev = 1;
+        }
+
+        // run의 다음 레코드로 root를 바꾸고, run이 끝나면 heap에서 제거
+        if (run_next(r)) {
+            heap_Update(heap, 0);
+        } else {
+            void *done;
+            heap_Delete(heap, &done);
+        }
+    }
+    if (ok && have_prev) sink(arg, prev, prev_len, prev_freq);
+
+    for (int i = 0; i < n; i++) {
+        if (readers[i].tok) tok_Close(readers[i].tok);
+    }
+    free(readers);
+    free(prev);
+    while (!heap_Empty(heap)) {
+        void *done;
+        heap_Delete(heap, &done);
+    }
+    heap_Destroy(heap, NULL); // heap은 비어 있음 (원소는 readers 배열이 소유)
+
+    return ok;
+}
+
+// merge 결과를 writer로 출력
+static void sink_write(void *arg, const char *word, int len, int freq) {
+    write_record((OUTBUF *)arg, word, len, freq);
+}
+
+// run 파일이 MERGE_FANIN개 이하가 될 때까지 앞의 MERGE_FANIN개씩 합쳐 새 run으로 만듦
+// by_freq : merge_runs와 같음
+// return   1 if successful
+//          0 if a run file cannot be read or written
+static int reduce_runs(tRuns *runs, int by_freq) {
+    while (runs->n > MERGE_FANIN) {
+        OUTBUF *out = runs_create(runs); // 목록의 끝에 추가됨
+        int ok;
+
+        if (out == NULL) return 0;
+
+        ok = merge_runs(runs->files, MERGE_FANIN, by_freq, sink_write, out);
+        if (!out_Close(out)) ok = 0;
+
+        for (int i = 0; i < MERGE_FANIN; i++) {
+            unlink(runs->files[i]);
+            free(runs->files[i]);
+        }
+        runs->n -= MERGE_FANIN;
+        memmove(runs->files, runs->files + MERGE_FANIN, runs->n * sizeof(char *));
+
+        if (!ok) return 0;
+    }
+    return 1;
+}
+
+// 빈도순 run으로 모은 레코드를 정렬하여 내보냄
+// 레코드는 단어순으로 들어오므로 빈도에 대한 stable radix pass만으로 compare_by_freq 순서가 됨
+// return   1 if successful
+//          0 if the file cannot be written
+static int flush_freq_spill(tFreqSpill *fs) {
+    OUTBUF *out;
+    int ok;
+
+    if (fs->n == 0) return 1;
+
+    for (int i = 0; i < fs->n; i++) {
+        fs->recs[i].word = fs->strs + (size_t)fs->recs[i].word;
+    }
+    if (!wsort_ByFreq(fs->recs, fs->n, sizeof(tWord), offsetof(tWord, word), offsetof(tWord, freq), WSORT_PRESORTED))
+        qsort(fs->recs, fs->n, sizeof(tWord), compare_by_freq);
+
+    if ((out = runs_create(fs->runs)) == NULL) return 0;
+    for (int i = 0; i < fs->n; i++) {
+        write_record(out, fs->recs[i].word, fs->recs[i].len, fs->recs[i].freq);
+    }
+    ok = out_Close(out);
+
+    fs->n = 0;
+    fs->used = 0;
+    return ok;
+}
+
+// 단어순 merge 결과를 빈도순 run으로 모음
+static void sink_freq(void *arg, const char *word, int len, int freq) {
+    tFreqSpill *fs = (tFreqSpill *)arg;
+
+    // 메모리 예산을 넘으면 지금까지 모은 레코드를 run으로 내보냄
+    if (fs->n > 0 && (size_t)fs->n * sizeof(tWord) + fs->used + len + 1 > fs->budget) {
+        if (!flush_freq_spill(fs)) {
+            fprintf(stderr, "cannot write run file\n");
+            exit(1);
+        }
+    }
+
+    if (fs->n == fs->cap) {
+        fs->cap *= 2;
+        fs->recs = (tWord *)realloc(fs->recs, fs->cap * sizeof(tWord));
+    }
+    while (fs->used + len + 1 > fs->strs_cap) {
+        fs->strs_cap *= 2;
+        fs->strs = (char *)realloc(fs->strs, fs->strs_cap);
+    }
+    if (fs->recs == NULL || fs->strs == NULL) {
+        fprintf(stderr, "Memory allocation error!\n");
+        exit(1);
+    }
+
+    memcpy(fs->strs + fs->used, word, len);
+    fs->strs[fs->used + len] = '\0';
+    fs->recs[fs->n].word = (char *)fs->used; // strs가 realloc될 수 있으므로 오프셋으로 저장
+    fs->recs[fs->n].len = len;
+    fs->recs[fs->n].freq = freq;
+    fs->n++;
+    fs->used += len + 1;
+}
+
+// 외부 모드로 단어를 세어 출력
+// budget : 사전(또는 빈도순 레코드)에 사용하는 메모리의 상한 (bytes)
+// return   1 if successful
+//          0 if the input or a run file cannot be opened or written
+int word_count_external(const char *filename, int option, size_t budget) {
+    TOKENIZER *tok = tok_Open(filename, 0); // 입력 파일도 읽기 전용으로 매핑
+    tRuns runs, fruns;
+    tWordDic *dic;
+    tToken token;
+    size_t bytes = 0;   // 사전의 단어 문자열에 사용한 메모리 (malloc 오버헤드 포함)
+    int ok = 1;
+
+    if (tok == NULL) return 0;
+    if (!runs_init(&runs)) {
+        tok_Close(tok);
+        return 0;
+    }
+
+    // 1단계: 메모리 예산만큼 세어 단어순 run으로 내보냄
+    dic = create_dic();
+    while (ok && tok_Next(tok, &token)) {
+        int len = dic->len;
+
+        add_word(dic, token.ptr, (int)token.len);
+        if (dic->len == len) continue;
+
+        bytes += (token.len + 1 + 8 + 15) & ~(size_t)15;
+        if ((size_t)dic->nblocks * sizeof(tBlock) + dic->capacity * (sizeof(tBlock *) + sizeof(tWord)) + bytes > budget) {
+            ok = spill_dic(&runs, dic);
+            dic = create_dic();
+            bytes = 0;
+        }
+    }
+    tok_Close(tok);
+    if (ok && dic->len > 0) ok = spill_dic(&runs, dic);
+    else destroy_dic(dic);
+
+    // 2단계: 단어순 run들을 합쳐 -n 결과를 만듦
+    if (ok) ok = reduce_runs(&runs, 0);
+
+    if (ok && option == SORT_BY_WORD) {
+        OUTBUF *out = out_Stdout();
+
+        ok = merge_runs(runs.files, runs.n, 0, sink_write, out);
+        out_Flush(out);
+    } else if (ok) {
+        // 3단계 (-f): 합친 결과를 빈도순 run으로 나누어 정렬한 뒤 다시 합침
+        tFreqSpill fs;
+
+        if (!runs_init(&fruns)) {
+            runs_destroy(&runs);
+            return 0;
+        }
+        fs.runs = &fruns;
+        fs.budget = budget;
+        fs.n = 0;
+        fs.cap = 1024;
+        fs.recs = (tWord *)malloc(fs.cap * sizeof(tWord));
+        fs.used = 0;
+        fs.strs_cap = 64 * 1024;
+        fs.strs = (char *)malloc(fs.strs_cap);
+
+        ok = merge_runs(runs.files, runs.n, 0, sink_freq, &fs);
+        if (ok) ok = flush_freq_spill(&fs);
+        free(fs.recs);
+        free(fs.strs);
+
+        if (ok) ok = reduce_runs(&fruns, 1);
+        if (ok) {
+            OUTBUF *out = out_Stdout();
+
+            ok = merge_runs(fruns.files, fruns.n, 1, sink_write, out);
+            out_Flush(out);
+        }
+        runs_destroy(&fruns);
+    }
+
+    runs_destroy(&runs);
+    return ok;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// 스트리밍 모드 (-s 옵션)
+// 표준 입력(또는 파일)을 끝까지 읽으면서 N 단어 또는 T 초마다 스냅샷을 출력
+// 스냅샷은 모두 같은 시점(직전까지 읽은 단어)의 사전에 대한 결과이며,
+// 비용은 직전 스냅샷 이후 바뀐 단어 수에 비례함 (사전 전체를 다시 정렬하지 않음)
+
+// SIGALRM에서 설정 (-t 옵션)
+static volatile sig_atomic_t snapshot_due = 0;
+
+static void on_alarm(int sig) {
+    (void)sig;
+    snapshot_due = 1;
+}
+
+// 단어 문자열로 사전의 단어 구조체를 찾음
+// return   단어 구조체에 대한 포인터 (블록이 나뉘면 바뀌므로 바로 사용할 것)
+//          NULL if not found
+static tWord *lookup_word(tWordDic *dic, const char *word) {
+    tWord key;
+    int found;
+    int index;
+    tBlock *block;
+
+    key.word = (char *)word;
+    key.len = (int)strlen(word);
+    key.key = wkey_Make(word, key.len);
+
+    block = dic->blocks[find_block(dic, &key)];
+    index = binary_search(&key, block->data, block->len, &found);
+
+    return found ? block->data + index : NULL;
+}
+
+// dset에서 단어 문자열 포인터가 있거나 들어갈 슬롯을 찾음 (linear probing)
+static int dset_slot(const tStream *st, const char *word) {
+    int mask = st->dirty_cap * 2 - 1;
+    int i = (int)(((uintptr_t)word >> 3) * 2654435761u) & mask;
+
+    while (st->dset[i] != NULL && st->dset[i] != word) {
+        i = (i + 1) & mask;
+    }
+    return i;
+}
+
+// dirty 배열과 dset의 용량을 2배로 늘림
+static void grow_dirty(tStream *st) {
+    st->dirty_cap *= 2;
+    st->dirty = (char **)realloc(st->dirty, st->dirty_cap * sizeof(char *));
+    st->dirty_slot = (int *)realloc(st->dirty_slot, st->dirty_cap * sizeof(int));
+    free(st->dset);
+    st->dset = (char **)calloc(st->dirty_cap * 2, sizeof(char *));
+    if (st->dirty == NULL || st->dirty_slot == NULL || st->dset == NULL) {
+        fprintf(stderr, "Memory allocation error!\n");
+        exit(1);
+    }
+    for (int i = 0; i < st->ndirty; i++) {
+        int slot = dset_slot(st, st->dirty[i]);
+
+        st->dset[slot] = st->dirty[i];
+        st->dirty_slot[i] = slot;
+    }
+}
+
+// 빈도가 바뀐 단어를 dirty 목록에 추가 (이미 있으면 무시)
+static void mark_dirty(tStream *st, char *word) {
+    int slot = dset_slot(st, word);
+
+    if (st->dset[slot] != NULL) return;
+
+    if (st->ndirty == st->dirty_cap) {
+        grow_dirty(st);
+        slot = dset_slot(st, word);
+    }
+    st->dset[slot] = word;
+    st->dirty_slot[st->ndirty] = slot;
+    st->dirty[st->ndirty++] = word;
+}
+
+// dirty 목록을 비움 (바뀐 단어 수에 비례)
+static void clear_dirty(tStream *st) {
+    for (int i = 0; i < st->ndirty; i++) {
+        st->dset[st->dirty_slot[i]] = NULL;
+    }
+    st->ndirty = 0;
+}
+
+// 단어 구조체 배열을 출력 (print_dic과 같은 형식)
+static void print_words(OUTBUF *out, const tWord *words, int n) {
+    for (int i = 0; i < n; i++) {
+        out_Write(out, words[i].word, words[i].len);
+        out_Char(out, '\t');
+        out_Int(out, words[i].freq);
+        out_Char(out, '\n');
+    }
+}
+
+// 스냅샷 출력
+// topk > 0 : 상위 topk개
+//   빈도는 증가만 하므로, 직전 상위 목록에 없고 빈도도 바뀌지 않은 단어는 상위 목록에 들어올 수 없음
+//   따라서 (직전 상위 목록 + dirty 단어)만 정렬하면 됨
+// topk == 0 : 직전 스냅샷 이후 빈도가 바뀐 단어와 그 빈도 (이전 스냅샷에 적용하면 전체 사전이 됨)
+void print_snapshot(tStream *st, tWordDic *dic) {
+    OUTBUF *out = out_Stdout();
+    int nchanged = st->ndirty;
+    int n = nchanged;
+    char **cand = st->dirty;
+    tWord *words;
+    char header[128];
+
+    // 후보 단어 문자열 (dirty + dirty에 없는 직전 상위 목록)
+    if (st->topk > 0) {
+        cand = (char **)malloc((nchanged + st->ntop + 1) * sizeof(char *));
+        memcpy(cand, st->dirty, nchanged * sizeof(char *));
+        for (int i = 0; i < st->ntop; i++) {
+            if (st->dset[dset_slot(st, st->top[i].word)] == NULL) cand[n++] = st->top[i].word;
+        }
+    }
+
+    // 현재 빈도
+    // 직전 상위 목록의 단어들은 모두 직전 topk번째 빈도(min_freq) 이상이므로
+    // 그보다 빈도가 작은 단어는 상위 목록에 들어올 수 없어 정렬에서 제외
+    words = (tWord *)malloc((n > 0 ? n : 1) * sizeof(tWord));
+    {
+        int min_freq = (st->topk > 0 && st->ntop == st->topk) ? st->top[st->ntop - 1].freq : 0;
+        int m = 0;
+
+        for (int i = 0; i < n; i++) {
+            tWord *w = lookup_word(dic, cand[i]);
+
+            if (w->freq >= min_freq) words[m++] = *w;
+        }
+        n = m;
+    }
+
+    if (st->topk > 0) {
+        qsort(words, n, sizeof(tWord), compare_by_freq);
+        if (n > st->topk) n = st->topk;
+
+        free(st->top);
+        st->top = (tWord *)malloc((n > 0 ? n : 1) * sizeof(tWord));
+        memcpy(st->top, words, n * sizeof(tWord));
+        st->ntop = n;
+        free(cand);
+    }
+
+    // 출력 순서 (상위 목록은 빈도순으로 정렬되어 있음)
+    if (st->option == SORT_BY_WORD) qsort(words, n, sizeof(tWord), compare_by_word);
+    else if (st->topk == 0) qsort(words, n, sizeof(tWord), compare_by_freq);
+
+    snprintf(header, sizeof(header), "== snapshot %d: tokens %ld, words %d, changed %d ==\n",
+             ++st->seq, st->tokens, dic->len, nchanged);
+    out_Str(out, header);
+    print_words(out, words, n);
+    out_Char(out, '\n');
+    out_Flush(out); // 스냅샷마다 내보냄
+
+    free(words);
+    clear_dirty(st);
+    st->last = st->tokens;
+    snapshot_due = 0;
+}
+
+// 스트리밍 모드로 단어를 셈
+// 입력이 끝나면 마지막 스냅샷을 출력
+void word_count_stream(TOKENIZER *tok, tWordDic *dic, tStream *st) {
+    tToken token;
+
+    while (tok_Next(tok, &token)) {
+        mark_dirty(st, add_word(dic, token.ptr, (int)token.len));
+        st->tokens++;
+
+        if ((st->every > 0 && st->tokens - st->last >= st->every) || snapshot_due) {
+            print_snapshot(st, dic);
+        }
+    }
+    if (st->tokens > st->last || st->seq == 0) print_snapshot(st, dic);
+}
+
+// 스트리밍 모드 상태를 초기화
+// seconds > 0이면 seconds 초마다 SIGALRM으로 스냅샷을 요청
+void init_stream(tStream *st, int option, int topk, long every, double seconds) {
+    st->option = option;
+    st->topk = topk;
+    st->every = every;
+    st->tokens = 0;
+    st->last = 0;
+    st->seq = 0;
+    st->dirty_cap = 1024;
+    st->dirty = (char **)malloc(st->dirty_cap * sizeof(char *));
+    st->dirty_slot = (int *)malloc(st->dirty_cap * sizeof(int));
+    st->dset = (char **)calloc(st->dirty_cap * 2, sizeof(char *));
+    st->ndirty = 0;
+    st->top = NULL;
+    st->ntop = 0;
+
+    if (seconds > 0) {
+        struct sigaction sa;
+        struct itimerval it;
+
+        memset(&sa, 0, sizeof(sa));
+        sa.sa_handler = on_alarm;
+        sa.sa_flags = SA_RESTART; // 입력을 기다리는 read가 중단되지 않도록 함
+        sigaction(SIGALRM, &sa, NULL);
+
+        it.it_value.tv_sec = (long)seconds;
+        it.it_value.tv_usec = (long)((seconds - (long)seconds) * 1e6);
+        if (it.it_value.tv_sec == 0 && it.it_value.tv_usec == 0) it.it_value.tv_usec = 1;
+        it.it_interval = it.it_value;
+        setitimer(ITIMER_REAL, &it, NULL);
+    }
+}
+
+// 스트리밍 모드 상태의 메모리를 해제
+void destroy_stream(tStream *st) {
+    struct itimerval it;
+
+    memset(&it, 0, sizeof(it));
+    setitimer(ITIMER_REAL, &it, NULL);
+
+    free(st->dirty);
+    free(st->dirty_slot);
+    free(st->dset);
+    free(st->top);
+}
+
+#ifdef WC_STATS
+// 벤치마크: 입력의 모든 단어를 사전(블록)에서 다시 찾음
+// return   찾은 단어의 수 (입력의 단어 수)
+static long stats_lookup(const char *filename, tWordDic *dic) {
+    TOKENIZER *tok = tok_Open(filename, TOK_CSTR);
+    tToken token;
+    long n = 0;
+
+    if (tok == NULL) return 0;
+
+    STATS_BEGIN();
+    while (tok_Next(tok, &token)) {
+        tWord key;
+        int found;
+        tBlock *block;
+
+        key.word = (char *)token.ptr;
+        key.len = (int)token.len;
+        key.key = wkey_Make(token.ptr, token.len);
+
+        block = dic->blocks[find_block(dic, &key)];
+        binary_search(&key, block->data, block->len, &found);
+        STATS_SINK(found);
+        n++;
+    }
+    STATS_END(STATS_LOOKUP, n);
+
+    tok_Close(tok);
+    return n;
+}
+#endif
+
 int main(int argc, char **argv) {
     tWordDic *dic;
-    FILE *fp;
+    TOKENIZER *tok;
     int option;
+    int nthreads = 1;
+    int stream = 0;         // -s : 스트리밍 모드
+    long every = 0;         // -e N : N 단어마다 스냅샷
+    double seconds = 0;     // -t SEC : SEC 초마다 스냅샷
+    int topk = 0;           // -k N : 빈도 상위 N개 스냅샷
+    long budget_mb = 0;     // -m MB : 외부 모드의 메모리 예산
+    const char *filename;
+    const char *prog = argv[0];
+
+    // 옵션 (-j N, -m MB, -s, -e N, -t SEC, -k N)
+    while (argc > 1 && argv[1][0] == '-' && strcmp(argv[1], "-n") != 0 && strcmp(argv[1], "-f") != 0) {
+        if (strcmp(argv[1], "-s") == 0) {
+            stream = 1;
+            argc--;
+            argv++;
+            continue;
+        }
+        if (argc < 3) break;
 
-    if (argc != 3) {
-        fprintf(stderr, "Usage: %s option FILE\n\n", argv[0]);
-        fprintf(stderr, "option\n\t-n\t\tsort by word\n\t-f\t\tsort by frequency\n");
+        if (strcmp(argv[1], "-j") == 0) {
+            // -j N : N개의 스레드로 단어를 셈
+            nthreads = atoi(argv[2]);
+            if (nthreads < 1 || nthreads > MAX_THREADS) {
+                fprintf(stderr, "invalid number of threads : %s\n", argv[2]);
+                return 1;
+            }
+        } else if (strcmp(argv[1], "-e") == 0) {
+            every = atol(argv[2]);
+            if (every < 1) {
+                fprintf(stderr, "invalid number of tokens : %s\n", argv[2]);
+                return 1;
+            }
+        } else if (strcmp(argv[1], "-t") == 0) {
+            seconds = atof(argv[2]);
+            if (seconds <= 0) {
+                fprintf(stderr, "invalid interval : %s\n", argv[2]);
+                return 1;
+            }
+        } else if (strcmp(argv[1], "-m") == 0) {
+            budget_mb = atol(argv[2]);
+            if (budget_mb < 1) {
+                fprintf(stderr, "invalid memory budget : %s\n", argv[2]);
+                return 1;
+            }
+        } else if (strcmp(argv[1], "-k") == 0) {
+            topk = atoi(argv[2]);
+            if (topk < 1) {
+                fprintf(stderr, "invalid number of words : %s\n", argv[2]);
+                return 1;
+            }
+        } else {
+            break;
+        }
+        argc -= 2;
+        argv += 2;
+    }
+
+    // 스트리밍 모드에서는 FILE을 생략하면 표준 입력
+    if (stream && argc == 2) filename = "-";
+    else if (argc == 3) filename = argv[2];
+    else {
+        fprintf(stderr, "Usage: %s [-j N] option FILE\n", prog);
+        fprintf(stderr, "       %s -m MB option FILE\n", prog);
+        fprintf(stderr, "       %s -s [-e N] [-t SEC] [-k N] option [FILE]\n\n", prog);
+        fprintf(stderr, "option\n\t-n\t\tsort by word\n\t-f\t\tsort by frequency\n\t-j N\t\tcount with N threads\n");
+        fprintf(stderr, "\t-m MB\t\texternal mode: count in runs of at most MB megabytes and merge them from disk\n");
+        fprintf(stderr, "\t-s\t\tstream mode: read FILE (default stdin) and print snapshots\n");
+        fprintf(stderr, "\t-e N\t\tsnapshot every N words (default %d if -t is not given)\n", STREAM_EVERY);
+        fprintf(stderr, "\t-t SEC\t\tsnapshot every SEC seconds\n");
+        fprintf(stderr, "\t-k N\t\tsnapshot the top N words by frequency (default: words changed since the last snapshot)\n");
         return 1;
     }
 
@@ -136,26 +1156,91 @@ int main(int argc, char **argv) {
         return 1;
     }
 
-    // 사전 초기화
-    dic = create_dic();
-
-    // 입력 파일 열기
-    if ((fp = fopen(argv[2], "r")) == NULL) {
-        fprintf(stderr, "cannot open file : %s\n", argv[2]);
+    if (!stream && (every > 0 || seconds > 0 || topk > 0)) {
+        fprintf(stderr, "-e, -t and -k require -s\n");
         return 1;
     }
 
-    // 입력 파일로부터 단어와 빈도를 사전에 저장
-    word_count(fp, dic);
-    fclose(fp);
+    if (budget_mb > 0) {
+        if (stream || nthreads > 1) {
+            fprintf(stderr, "-m cannot be used with -s or -j\n");
+            return 1;
+        }
+        // run 파일은 TMPDIR (없으면 /tmp)에 만들고 끝나면 삭제
+        if (!word_count_external(filename, option, (size_t)budget_mb * 1024 * 1024)) {
+            fprintf(stderr, "cannot count file externally : %s\n", filename);
+            return 1;
+        }
+        return 0;
+    }
+
+    if (stream) {
+        tStream st;
+
+        if (nthreads > 1) {
+            fprintf(stderr, "-j cannot be used with -s\n");
+            return 1;
+        }
+        if ((tok = tok_Open(filename, TOK_CSTR)) == NULL) {
+            fprintf(stderr, "cannot open file : %s\n", filename);
+            return 1;
+        }
+        if (every == 0 && seconds == 0) every = STREAM_EVERY;
+
+        dic = create_dic();
+        init_stream(&st, option, topk, every, seconds);
+
+        word_count_stream(tok, dic, &st);
+
+        tok_Close(tok);
+        destroy_stream(&st);
+        destroy_dic(dic);
+        return 0;
+    }
+
+    if (nthreads > 1) {
+        // 구간별로 병렬로 센 뒤 합침
+        if ((dic = word_count_parallel(filename, nthreads)) == NULL) {
+            fprintf(stderr, "cannot open file : %s\n", filename);
+            return 1;
+        }
+    } else {
+        // 사전 초기화
+        dic = create_dic();
+
+        // 입력 파일 열기
+        if ((tok = tok_Open(filename, TOK_CSTR)) == NULL) {
+            fprintf(stderr, "cannot open file : %s\n", filename);
+            return 1;
+        }
+
+        // 입력 파일로부터 단어와 빈도를 사전에 저장
+        STATS_BEGIN();
+        word_count(tok, dic);
+        STATS_END(STATS_BUILD, 0);
+        tok_Close(tok);
+
+#ifdef WC_STATS
+        STATS_OPS(STATS_BUILD, stats_lookup(filename, dic));
+#endif
+
+        // 정렬된 블록들을 하나의 배열로 펼침
+        flatten_dic(dic);
+    }
 
     // 정렬 (빈도 내림차순, 빈도가 같은 경우 단어순)
+    // data는 이미 단어순이므로 빈도에 대한 stable radix pass만으로 compare_by_freq와 같은 순서가 됨
+    // (메모리가 부족하면 qsort 사용)
     if (option == SORT_BY_FREQ) {
-        qsort(dic->data, dic->len, sizeof(tWord), compare_by_freq);
+        if (!wsort_ByFreq(dic->data, dic->len, sizeof(tWord), offsetof(tWord, word), offsetof(tWord, freq), WSORT_PRESORTED))
+            qsort(dic->data, dic->len, sizeof(tWord), compare_by_freq);
     }
 
     // 사전을 화면에 출력
+    STATS_BEGIN();
     print_dic(dic);
+    STATS_END(STATS_DUMP, dic->len);
+    STATS_REPORT(dic->len);
 
     // 사전 메모리 해제
     destroy_dic(dic);
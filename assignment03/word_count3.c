@@ -1,6 +1,11 @@
 #include <stdio.h>
 #include <stdlib.h> // malloc
-#include <string.h> // strdup, strcmp
+#include <string.h> // strlen, strcmp
+
+#include "tokenizer.h"
+#include "str_arena.h"
+#include "outbuf.h"
+#include "wc_stats.h"
 
 #define SORT_BY_WORD	0 // 단어 순 정렬
 #define SORT_BY_FREQ	1 // 빈도 순 정렬
@@ -12,25 +17,43 @@ typedef struct {
 	int		freq;		// 빈도
 } tWord;
 
+// 단어 문자열 저장소
+// 모든 단어 구조체의 word는 여기에 인터닝되며, 사전을 해제할 때 한 번에 해제
+static STRARENA *word_arena;
+
 ////////////////////////////////////////////////////////////////////////////////
 // LIST type definition
 typedef struct node
 {
 	tWord		*dataPtr;
 	struct node	*link; // 단어순 리스트를 위한 포인터
-	struct node	*link2; // 빈도순 리스트를 위한 포인터
+	struct node	*link2; // 같은 빈도 bucket 안의 다음 노드
+	struct node	*prev2; // 같은 빈도 bucket 안의 이전 노드
+	struct bucket	*bucket; // 노드가 속한 빈도 bucket
 } NODE;
 
+// 빈도 bucket (LFU 방식)
+// 빈도가 같은 단어들을 이중 연결 리스트로 묶고, bucket끼리는 빈도순으로 이중 연결
+// 빈도가 1 증가하면 노드를 바로 위 bucket으로 옮기므로 O(1)
+typedef struct bucket
+{
+	int				freq;
+	NODE			*head; // bucket의 첫번째 노드
+	NODE			*tail; // bucket의 마지막 노드
+	struct bucket	*higher; // 빈도가 더 큰 bucket
+	struct bucket	*lower; // 빈도가 더 작은 bucket
+} BUCKET;
+
 typedef struct
 {
 	int		count;
 	NODE	*head; // 단어순 리스트의 첫번째 노드에 대한 포인터
-	NODE	*head2; // 빈도순 리스트의 첫번째 노드에 대한 포인터
+	BUCKET	*top; // 빈도가 가장 큰 bucket
+	BUCKET	*bottom; // 빈도가 가장 작은 bucket
 } LIST;
 
 ////////////////////////////////////////////////////////////////////////////////
 // Prototype declarations
-int compare_by_freq( const void *n1, const void *n2);
 tWord *createWord(char *word);
 void destroyWord(tWord *pNode);
 
@@ -42,7 +65,8 @@ LIST *createList(void) {
     if (list) { //메모리가 할당되었다면
         list->count = 0;
         list->head = NULL;
-        list->head2 = NULL;
+        list->top = NULL;
+        list->bottom = NULL;
     }
     return list;
 }
@@ -61,6 +85,14 @@ void destroyList(LIST *pList) {
         pCur = pNext;
     }
 	 pList->count = 0;
+
+    // 빈도 bucket 메모리 해제
+    BUCKET *pBucket = pList->top;
+    while (pBucket) {
+        BUCKET *pLower = pBucket->lower;
+        free(pBucket);
+        pBucket = pLower;
+    }
     // 리스트 구조체 자체의 메모리 해제
     free(pList);
 	
@@ -77,6 +109,7 @@ static int _search(LIST *pList, NODE **pPre, NODE **pLoc, tWord *pArgu) {
     *pLoc = pList->head;
 
     while (*pLoc) {
+        STATS_CMP();
         int cmp = strcmp((*pLoc)->dataPtr->word, pArgu->word);
         if (cmp >= 0) break;
 
@@ -89,20 +122,95 @@ static int _search(LIST *pList, NODE **pPre, NODE **pLoc, tWord *pArgu) {
 }
 
 
-static int _search_by_freq(LIST *pList, NODE **pPre, NODE **pLoc, tWord *pArgu) {
-    *pPre = NULL;
-    *pLoc = pList->head2; 
+// internal function
+// 노드를 bucket의 끝에 추가
+static void _bucket_append(BUCKET *pBucket, NODE *pNode) {
+    pNode->bucket = pBucket;
+    pNode->link2 = NULL;
+    pNode->prev2 = pBucket->tail;
+    if (pBucket->tail) pBucket->tail->link2 = pNode;
+    else pBucket->head = pNode;
+    pBucket->tail = pNode;
+}
 
-    while (*pLoc) {
-        int cmp = compare_by_freq((*pLoc)->dataPtr, pArgu);
-        if (cmp > 0) break;
+// internal function
+// 노드를 bucket에서 분리
+static void _bucket_remove(BUCKET *pBucket, NODE *pNode) {
+    if (pNode->prev2) pNode->prev2->link2 = pNode->link2;
+    else pBucket->head = pNode->link2;
+    if (pNode->link2) pNode->link2->prev2 = pNode->prev2;
+    else pBucket->tail = pNode->prev2;
+}
 
-        *pPre = *pLoc;
-        *pLoc = (*pLoc)->link2;
+// internal function
+// 빈도가 freq인 빈 bucket을 lower와 higher 사이에 연결
+// return	bucket pointer
+// 			NULL if overflow
+static BUCKET *_bucket_create(LIST *pList, int freq, BUCKET *lower, BUCKET *higher) {
+    BUCKET *pBucket = (BUCKET *)malloc(sizeof(BUCKET));
+    if (!pBucket) return NULL;
+
+    pBucket->freq = freq;
+    pBucket->head = NULL;
+    pBucket->tail = NULL;
+    pBucket->lower = lower;
+    pBucket->higher = higher;
+
+    if (lower) lower->higher = pBucket;
+    else pList->bottom = pBucket;
+    if (higher) higher->lower = pBucket;
+    else pList->top = pBucket;
+
+    return pBucket;
+}
+
+// internal function
+// 빈 bucket을 연결에서 제거하고 해제
+static void _bucket_destroy(LIST *pList, BUCKET *pBucket) {
+    if (pBucket->lower) pBucket->lower->higher = pBucket->higher;
+    else pList->bottom = pBucket->higher;
+    if (pBucket->higher) pBucket->higher->lower = pBucket->lower;
+    else pList->top = pBucket->lower;
+
+    free(pBucket);
+}
+
+// internal function
+// 새 노드를 빈도 1인 bucket에 연결
+// for update_dic function
+// return	1 if successful
+// 			0 if memory overflow
+static int _link_by_freq(LIST *pList, NODE *pNode) {
+    BUCKET *pBucket = pList->bottom;
+
+    if (!pBucket || pBucket->freq != 1) {
+        pBucket = _bucket_create(pList, 1, NULL, pList->bottom);
+        if (!pBucket) return 0;
+    }
+    _bucket_append(pBucket, pNode);
+    return 1;
+}
+
+// internal function
+// 단어의 빈도를 1 증가시키고 노드를 바로 위 bucket으로 옮김
+// for update_dic function
+// return	1 if successful
+// 			0 if memory overflow (빈도는 바뀌지 않음)
+static int _increase_freq(LIST *pList, NODE *pNode) {
+    BUCKET *pBucket = pNode->bucket;
+    BUCKET *pHigher = pBucket->higher;
+
+    if (!pHigher || pHigher->freq != pBucket->freq + 1) {
+        pHigher = _bucket_create(pList, pBucket->freq + 1, pBucket, pBucket->higher);
+        if (!pHigher) return 0;
     }
 
-    if (*pLoc && compare_by_freq((*pLoc)->dataPtr, pArgu) == 0) return 1;
-    return 0;
+    _bucket_remove(pBucket, pNode);
+    _bucket_append(pHigher, pNode);
+    pNode->dataPtr->freq++;
+
+    if (!pBucket->head) _bucket_destroy(pList, pBucket);
+    return 1;
 }
 
 // internal insert function
@@ -115,6 +223,10 @@ static int _insert(LIST *pList, NODE *pPre, tWord *dataInPtr) {
     if (!pNew) return 0;
 
     pNew->dataPtr = dataInPtr;
+    if (!_link_by_freq(pList, pNew)) {
+        free(pNew);
+        return 0;
+    }
 
     if (!pPre) { //새로운 노드를 리스트 맨 앞에 삽입하는 경우
         pNew->link = pList->head;
@@ -138,60 +250,58 @@ void update_dic(LIST *list, char *word) {
 
     NODE *pPre, *pLoc;
     int found = _search(list, &pPre,&pLoc, newWord);
-    if (found) { //이미 사전에 존재하는 단어 빈도 갱신
-        pLoc->dataPtr->freq++;
+    if (found) { //이미 사전에 존재하는 단어 빈도 갱신 (빈도 bucket도 함께 이동)
+        _increase_freq(list, pLoc);
+        destroyWord(newWord);
+    } else if (!_insert(list, pPre, newWord)) { //새로 등장한 단어 사전에 추가
         destroyWord(newWord);
-    } else { //새로 등장한 단어 사전에 추가
-        _insert(list, pPre, newWord);
     }
 }
 
 
 
-// internal function
-// for connect_by_frequency function
-// connects node into a frequency list
-static void _link_by_freq(LIST *pList, NODE *pPre, NODE *pLoc) {
-    if (!pPre) { //삽입할 노드가 맨 앞에 삽입되는 경우
-        pLoc->link2 = pList->head2;
-        pList->head2 = pLoc;
-    } else { //삽입할 노드가 중간 또는 끝에 삽입되는 경우
-        pLoc->link2 = pPre->link2;
-        pPre->link2 = pLoc;
-    }
-}
-
-
-// 단어순 리스트를 순회하며 빈도순 리스트로 연결
+// 빈도 bucket 안의 노드를 단어순으로 정렬
+// 단어순 리스트를 한 번 순회하며 각 노드를 자기 bucket의 끝으로 다시 붙이므로 O(n)
+// bucket 자체는 입력을 읽는 동안 이미 빈도순으로 유지됨
 void connect_by_frequency(LIST *list) {
-    list->head2 = NULL; // 빈도순 리스트 초기화
-    NODE *pCurWord = list->head; // 단어순 리스트의 현재 노드를 가리키는 포인터
-
-    while (pCurWord != NULL) {
-        NODE *pPreFreq, *pLocFreq;
-        _search_by_freq(list, &pPreFreq, &pLocFreq, pCurWord->dataPtr);
-        _link_by_freq(list, pPreFreq, pCurWord); // 빈도순 리스트에 삽입
-        pCurWord = pCurWord->link; // 다음 단어로 이동
+    NODE *pCur = list->head;
+
+    while (pCur != NULL) {
+        _bucket_remove(pCur->bucket, pCur);
+        _bucket_append(pCur->bucket, pCur);
+        pCur = pCur->link; // 다음 단어로 이동
     }
 }
-    
-    
 
 // 사전을 화면에 출력 ("단어\t빈도" 형식)
 void print_dic(LIST *pList) {
+    OUTBUF *out = out_Stdout();
     NODE *pCur = pList->head;
     while (pCur) {
-        printf("%s\t%d\n", pCur->dataPtr->word, pCur->dataPtr->freq);
+        out_Str(out, pCur->dataPtr->word);
+        out_Char(out, '\t');
+        out_Int(out, pCur->dataPtr->freq);
+        out_Char(out, '\n');
         pCur = pCur->link;
     }
+    out_Flush(out);
 } // 단어순
 
 void print_dic_by_freq(LIST *pList) {
-    NODE *pCur = pList->head2;
-    while (pCur) {
-        printf("%s\t%d\n", pCur->dataPtr->word, pCur->dataPtr->freq);
-        pCur = pCur->link2;
+    OUTBUF *out = out_Stdout();
+    BUCKET *pBucket = pList->top;
+    while (pBucket) { // 빈도가 큰 bucket부터
+        NODE *pCur = pBucket->head;
+        while (pCur) {
+            out_Str(out, pCur->dataPtr->word);
+            out_Char(out, '\t');
+            out_Int(out, pCur->dataPtr->freq);
+            out_Char(out, '\n');
+            pCur = pCur->link2;
+        }
+        pBucket = pBucket->lower;
     }
+    out_Flush(out);
 }
  // 빈도순
 
@@ -203,7 +313,7 @@ tWord *createWord(char *word) {
     tWord *newWord = (tWord *)malloc(sizeof(tWord));
     if (!newWord) return NULL;
 
-    newWord->word = strdup(word);
+    newWord->word = (char *)strarena_Intern(word_arena, word, strlen(word));
     if (!newWord->word) {
         free(newWord);
         return NULL;
@@ -215,10 +325,10 @@ tWord *createWord(char *word) {
 
 
 //  단어 구조체에 할당된 메모리를 해제
+// 단어 문자열은 word_arena가 일괄 해제
 // for destroyList function
 void destroyWord(tWord *pNode) {
     if (!pNode) return;
-    free(pNode->word);
     free(pNode);
 }
 
@@ -233,29 +343,42 @@ int compare_by_word( const void *n1, const void *n2)
 	
 	return strcmp( p1->word, p2->word);
 }
+
+#ifdef WC_STATS
 ////////////////////////////////////////////////////////////////////////////////
-// for _search_by_freq function
-// 정렬 기준 : 빈도 내림차순(1순위), 단어(2순위)
-int compare_by_freq( const void *n1, const void *n2)
+// 벤치마크: 입력의 모든 단어를 사전(단어순 리스트)에서 다시 찾음
+// return	찾은 단어의 수 (입력의 단어 수)
+static long stats_lookup( const char *filename, LIST *list)
 {
-	tWord *p1 = (tWord *)n1;
-	tWord *p2 = (tWord *)n2;
+	TOKENIZER *tok = tok_Open( filename, TOK_CSTR);
+	tToken token;
+	NODE *pPre, *pLoc;
+	tWord key;
+	long n = 0;
 	
-	int ret = (int) p2->freq - p1->freq;
+	if (tok == NULL) return 0;
 	
-	if (ret != 0) return ret;
+	STATS_BEGIN();
+	while (tok_Next( tok, &token))
+	{
+		key.word = (char *)token.ptr;
+		STATS_SINK( _search( list, &pPre, &pLoc, &key));
+		n++;
+	}
+	STATS_END( STATS_LOOKUP, n);
 	
-	return strcmp( p1->word, p2->word); //빈도가 동일한 경우
+	tok_Close( tok);
+	return n;
 }
-
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 int main( int argc, char **argv)
 {
 	LIST *list;
 	int option;
-	FILE *fp;
-	char word[1000];
+	TOKENIZER *tok;
+	tToken token;
 	
 	if (argc != 3)
 	{
@@ -273,26 +396,35 @@ int main( int argc, char **argv)
 
 	// creates an empty list
 	list = createList();
+	word_arena = strarena_Create();
 	
-	if (!list)
+	if (!list || !word_arena)
 	{
 		printf( "Cannot create list\n");
 		return 100;
 	}
 
-	if ((fp = fopen( argv[2], "r")) == NULL) 
+	if ((tok = tok_Open( argv[2], TOK_CSTR)) == NULL) 
 	{
 		fprintf( stderr, "cannot open file : %s\n", argv[2]);
 		return 1;
 	}
 	
-	while(fscanf( fp, "%s", word) != EOF)
+	STATS_BEGIN();
+	while(tok_Next( tok, &token))
 	{
 		// 사전(단어순 리스트) 업데이트
-		update_dic( list, word);
+		update_dic( list, (char *)token.ptr);
 	}
+	STATS_END( STATS_BUILD, 0);
+	
+	tok_Close( tok);
+
+#ifdef WC_STATS
+	STATS_OPS( STATS_BUILD, stats_lookup( argv[2], list));
+#endif
 	
-	fclose( fp);
+	STATS_BEGIN();
 
 	if (option == SORT_BY_WORD) {
 		
@@ -301,15 +433,18 @@ int main( int argc, char **argv)
 	}
 	else { // SORT_BY_FREQ
 	
-		// 빈도순 리스트 연결
+		// 빈도 bucket 안을 단어순으로 정렬
 		connect_by_frequency( list);
 		
 		// 빈도순 리스트를 화면에 출력
 		print_dic_by_freq( list);
 	}
+	STATS_END( STATS_DUMP, list->count);
+	STATS_REPORT( list->count);
 	
 	// 단어 리스트 메모리 해제
 	destroyList( list);
+	strarena_Destroy( word_arena);
 	
 	return 0;
 }
@@ -1,8 +1,14 @@
 #include <stdio.h>
 #include <stdlib.h> // malloc
-#include <string.h> // strdup, strcmp
+#include <string.h> // strlen, strcmp
 #include <ctype.h> // toupper
 
+#include "tokenizer.h"
+#include "str_arena.h"
+#include "outbuf.h"
+#include "wc_stats.h"
+#include "word_batch.h"
+
 #define QUIT			1
 #define FORWARD_PRINT	2
 #define BACKWARD_PRINT	3
@@ -17,6 +23,10 @@ typedef struct {
 	int		freq;		// 빈도
 } tWord;
 
+// 단어 문자열 저장소
+// 모든 단어 구조체의 word는 여기에 인터닝되며, 사전을 해제할 때 한 번에 해제
+static STRARENA *word_arena;
+
 ////////////////////////////////////////////////////////////////////////////////
 // LIST type definition
 typedef struct node
@@ -31,6 +41,7 @@ typedef struct
 	int		count;
 	NODE	*head; //맨 앞 가리키는 포인터
 	NODE	*rear; //맨 뒤 가리키는 포인터
+	NODE	*finger; //마지막으로 삽입한 노드 (탐색 시작 위치)
 } LIST;
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -48,6 +59,7 @@ void traverseListR(LIST *pList, void (*callback)(const tWord *));
 static int _insert(LIST *pList, NODE *pPre, tWord *dataInPtr);
 static void _delete(LIST *pList, NODE *pPre, NODE *pLoc, tWord **dataOutPtr);
 static int _search(LIST *pList, NODE **pPre, NODE **pLoc, tWord *pArgu);
+static int _search_finger(LIST *pList, NODE **pPre, NODE **pLoc, tWord *pArgu);
 tWord *createWord(char *word);
 int get_action();
 int compare_by_word(const void *n1, const void *n2);
@@ -64,6 +76,7 @@ LIST *createList(void) {
         pList->count = 0; // 리스트의 노드 개수 초기화
         pList->head = NULL; // 리스트의 헤드를 NULL로 초기화
         pList->rear = NULL; // 리스트의 리어를 NULL로 초기화
+        pList->finger = NULL;
     }
     
     return pList; // 생성된 리스트 구조체 포인터 반환
@@ -221,6 +234,7 @@ static int _insert( LIST *pList, NODE *pPre, tWord *dataInPtr){
 		
 		// 리스트의 노드 개수 증가
 		(pList->count)++;
+		pList->finger=pNew; // 다음 탐색은 여기서 시작
 		
 		return 1; // 성공 반환
 }
@@ -231,6 +245,8 @@ static int _insert( LIST *pList, NODE *pPre, tWord *dataInPtr){
 static void _delete( LIST *pList, NODE *pPre, NODE *pLoc, tWord **dataOutPtr){
 	*dataOutPtr=pLoc->dataPtr;
 	
+	if(pList->finger == pLoc) pList->finger = (pPre != NULL) ? pPre : pLoc->rlink;
+	
 	 // 삭제할 노드의 이전 노드가 있는 경우
 	if(pPre != NULL){
 		pPre->rlink=pLoc->rlink;
@@ -257,6 +273,25 @@ static void _delete( LIST *pList, NODE *pPre, NODE *pLoc, tWord **dataOutPtr){
 // return	1 found
 // 			0 not found
 static int _search(LIST *pList, NODE **pPre, NODE **pLoc, tWord *pArgu) {
+    // 맨 뒤 또는 맨 앞이면 바로 결정 (정렬된 입력은 항상 맨 뒤에 추가되므로 O(1))
+    if (pList->rear != NULL) {
+        int cmp = compare_by_word(pArgu, pList->rear->dataPtr);
+
+        if (cmp >= 0) {
+            *pPre = (cmp > 0) ? pList->rear : pList->rear->llink;
+            *pLoc = (cmp > 0) ? NULL : pList->rear;
+            return (cmp == 0);
+        }
+        if (pList->head != pList->rear && (cmp = compare_by_word(pArgu, pList->head->dataPtr)) <= 0) {
+            *pPre = NULL;
+            *pLoc = pList->head;
+            return (cmp == 0);
+        }
+    }
+
+    // 마지막으로 삽입한 노드에서 앞 또는 뒤로 탐색 (거의 정렬된 입력은 가까운 곳에 있음)
+    if (pList->finger != NULL) return _search_finger(pList, pPre, pLoc, pArgu);
+
     *pPre = NULL; // 이전 노드 초기화
     *pLoc = pList->head; // 현재 노드를 헤드로 초기화
     
@@ -276,6 +311,36 @@ static int _search(LIST *pList, NODE **pPre, NODE **pLoc, tWord *pArgu) {
   
 }
 
+// internal search function
+// finger에서 시작하여 대상 쪽으로 앞(rlink) 또는 뒤(llink)로 이동
+// for _search function
+// return	1 found
+// 			0 not found
+static int _search_finger(LIST *pList, NODE **pPre, NODE **pLoc, tWord *pArgu) {
+    NODE *pCur = pList->finger;
+    int cmp = compare_by_word(pArgu, pCur->dataPtr);
+
+    if (cmp > 0) { // finger 뒤쪽: 대상 이상인 첫 노드까지 앞으로
+        *pPre = pCur;
+        *pLoc = pCur->rlink;
+        while (*pLoc != NULL && (cmp = compare_by_word(pArgu, (*pLoc)->dataPtr)) > 0) {
+            *pPre = *pLoc;
+            *pLoc = (*pLoc)->rlink;
+        }
+        return (*pLoc != NULL && cmp == 0);
+    }
+
+    // finger 앞쪽 (또는 finger): 대상 이하인 첫 노드까지 뒤로
+    while (cmp < 0 && pCur->llink != NULL) {
+        cmp = compare_by_word(pArgu, pCur->llink->dataPtr);
+        if (cmp <= 0) pCur = pCur->llink;
+        if (cmp == 0) break;
+    }
+    *pPre = pCur->llink;
+    *pLoc = pCur;
+    return (cmp == 0);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // 단어 구조체를 위한 메모리를 할당하고 word, freq 초기화// return	word structure pointer
 // return	할당된 단어 구조체에 대한 pointer
@@ -284,7 +349,7 @@ tWord *createWord( char *word){
 	tWord *pWord=(tWord *)malloc(sizeof(tWord));
 	
 	if(pWord != NULL){
-		pWord->word=strdup(word);
+		pWord->word=(char *)strarena_Intern(word_arena, word, strlen(word));
 		pWord->freq=1;
 	
 	}
@@ -293,10 +358,10 @@ tWord *createWord( char *word){
 }
 
 //  단어 구조체에 할당된 메모리를 해제
+// 단어 문자열은 word_arena가 일괄 해제
 // for destroyList function
 void destroyWord( tWord *pNode){
 	if(pNode != NULL){
-		free(pNode->word); //단어 메모리 해제
 		free(pNode); //단어 구조체 메모리 해제
 	}
 }
@@ -334,6 +399,7 @@ int compare_by_word( const void *n1, const void *n2)
 	tWord *p1 = (tWord *)n1;
 	tWord *p2 = (tWord *)n2;
 	
+	STATS_CMP();
 	return strcmp( p1->word, p2->word);
 }
 
@@ -341,7 +407,12 @@ int compare_by_word( const void *n1, const void *n2)
 // for traverseList and traverseListR functions
 void print_word(const tWord *dataPtr)
 {
-	printf( "%s\t%d\n", dataPtr->word, dataPtr->freq);
+	OUTBUF *out = out_Stdout();
+	
+	out_Str( out, dataPtr->word);
+	out_Char( out, '\t');
+	out_Int( out, dataPtr->freq);
+	out_Char( out, '\n');
 }
 
 // gets user's input
@@ -351,6 +422,118 @@ void input_word(char *word)
 	fscanf( stdin, "%s", word);
 }
 
+#ifdef WC_STATS
+////////////////////////////////////////////////////////////////////////////////
+// 벤치마크: 입력의 모든 단어를 사전(단어순 리스트)에서 다시 찾음
+// return	찾은 단어의 수 (입력의 단어 수)
+static long stats_lookup( const char *filename, LIST *list)
+{
+	TOKENIZER *tok = tok_Open( filename, TOK_CSTR);
+	tToken token;
+	tWord key;
+	tWord *ptr;
+	long n = 0;
+	
+	if (tok == NULL) return 0;
+	
+	STATS_BEGIN();
+	while (tok_Next( tok, &token))
+	{
+		key.word = (char *)token.ptr;
+		STATS_SINK( searchNode( list, &key, &ptr));
+		n++;
+	}
+	STATS_END( STATS_LOOKUP, n);
+	
+	tok_Close( tok);
+	return n;
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// 질의 파일 (--batch, --batch-each)
+
+// merge-join할 최소 run 길이
+// 질의 하나가 평균 리스트의 절반을 지나므로, 두 개부터는 순회 한 번이 더 빠름
+#define BATCH_MIN_RUN( count)	2
+
+// merge-join 중인 질의 파일 (match_word에서 사용)
+static WBATCH *batch;
+
+// 사전의 단어를 batch의 질의와 맞춤
+// for traverseList function (단어순으로 호출됨)
+static void match_word( const tWord *dataPtr)
+{
+	wbatch_Match( batch, dataPtr->word, (void *)dataPtr);
+}
+
+// 질의 결과를 출력 (메뉴의 S)earch, D)elete와 같은 형식)
+static void print_result( const tQuery *q)
+{
+	OUTBUF *out = out_Stdout();
+	const tWord *w = (const tWord *)q->result;
+	
+	if (w == NULL)
+	{
+		out_Str( out, q->word);
+		out_Str( out, " not found\n");
+	}
+	else if (q->op == WBATCH_SEARCH) print_word( w);
+	else
+	{
+		out_Char( out, '(');
+		out_Str( out, w->word);
+		out_Str( out, ", ");
+		out_Int( out, w->freq);
+		out_Str( out, ") deleted\n");
+	}
+}
+
+// 질의 파일의 S, D를 차례로 처리하고 결과를 질의 순서대로 출력
+// merge이면 연속된 S를 단어순으로 정렬하여 리스트 순회 한 번으로 답하고 (BATCH_MIN_RUN 이상일 때), 나머지는 질의마다 searchNode
+// return	0 if successful
+//			2 if the query file cannot be read
+static int run_batch( const char *filename, LIST *list, int merge)
+{
+	tWord key;
+	tWord *ptr;
+	int end;
+	
+	if ((batch = wbatch_Load( filename)) == NULL) return 2;
+	
+	STATS_BEGIN();
+	for (int i = 0; i < batch->count; i = end)
+	{
+		end = merge ? wbatch_RunEnd( batch, i) : i;
+		if (end - i >= BATCH_MIN_RUN( countList( list)) && wbatch_Begin( batch, i, end))
+		{
+			traverseList( list, match_word);
+			for (int j = i; j < end; j++) print_result( &batch->queries[j]);
+			continue;
+		}
+		
+		// D 질의, 또는 merge-join하기에 짧은 run은 질의마다 처리
+		if (end == i) end = i + 1;
+		for (int j = i; j < end; j++)
+		{
+			tQuery *q = &batch->queries[j];
+			
+			key.word = q->word;
+			if (q->op == WBATCH_SEARCH) q->result = searchNode( list, &key, &ptr) ? ptr : NULL;
+			else q->result = removeNode( list, &key, &ptr) ? ptr : NULL;
+			
+			print_result( q);
+			if (q->op == WBATCH_DELETE && q->result) destroyWord( q->result);
+		}
+	}
+	STATS_END( STATS_LOOKUP, batch->count);
+	
+	out_Flush( out_Stdout());
+	wbatch_Close( batch);
+	batch = NULL;
+	return 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 int main( int argc, char **argv)
 {
@@ -358,16 +541,30 @@ int main( int argc, char **argv)
 	
 	char word[100];
 	tWord *pWord;
+	tWord key; // S)earch, D)elete의 탐색 키 (word는 입력 버퍼, 인터닝하지 않음)
 	int ret;
-	FILE *fp;
+	TOKENIZER *tok;
+	tToken token;
+	const char *batch_file = NULL;
+	int batch_merge = 1;
+	
+	// --batch QUERIES FILE : 사전을 만든 뒤 메뉴 대신 질의 파일을 처리
+	// --batch-each QUERIES FILE : 같은 처리를 질의마다 탐색하여 수행 (비교용)
+	if (argc == 4 && (strcmp( argv[1], "--batch") == 0 || strcmp( argv[1], "--batch-each") == 0))
+	{
+		batch_file = argv[2];
+		batch_merge = (strcmp( argv[1], "--batch") == 0);
+		argc -= 2;
+		argv += 2;
+	}
 	
 	if (argc != 2){
-		fprintf( stderr, "usage: %s FILE\n", argv[0]);
+		fprintf( stderr, "usage: %s [--batch QUERIES | --batch-each QUERIES] FILE\n", argv[0]);
 		return 1;
 	}
 	
-	fp = fopen( argv[1], "rt");
-	if (!fp)
+	tok = tok_Open( argv[1], TOK_CSTR);
+	if (!tok)
 	{
 		fprintf( stderr, "Error: cannot open file [%s]\n", argv[1]);
 		return 2;
@@ -375,15 +572,17 @@ int main( int argc, char **argv)
 	
 	// creates an empty list
 	list = createList();
-	if (!list)
+	word_arena = strarena_Create();
+	if (!list || !word_arena)
 	{
 		printf( "Cannot create list\n");
 		return 100;
 	}
 	
-	while(fscanf( fp, "%s", word) != EOF)
+	STATS_BEGIN();
+	while(tok_Next( tok, &token))
 	{
-		pWord = createWord(word);
+		pWord = createWord( (char *)token.ptr);
 		
 		//이미 저장된 단어는 빈도 증가
 		ret = addNode( list, pWord);
@@ -393,8 +592,22 @@ int main( int argc, char **argv)
 			destroyWord( pWord);
 		}
 	}
+	STATS_END( STATS_BUILD, 0);
+	
+	tok_Close( tok);
+
+#ifdef WC_STATS
+	STATS_OPS( STATS_BUILD, stats_lookup( argv[1], list));
+#endif
 	
-	fclose( fp);
+	if (batch_file)
+	{
+		ret = run_batch( batch_file, list, batch_merge);
+		STATS_REPORT( countList( list));
+		destroyList( list);
+		strarena_Destroy( word_arena);
+		return ret;
+	}
 	
 	fprintf( stderr, "Select Q)uit, P)rint, B)ackward print, S)earch, D)elete, C)ount: ");
 	
@@ -406,11 +619,16 @@ int main( int argc, char **argv)
 		switch( action)
 		{
 			case QUIT:
+				STATS_REPORT( countList( list));
 				destroyList( list);
+				strarena_Destroy( word_arena);
 				return 0;
 			
 			case FORWARD_PRINT:
+				STATS_BEGIN();
 				traverseList( list, print_word);
+				out_Flush( out_Stdout());
+				STATS_END( STATS_DUMP, countList( list));
 				break;
 			
 			case BACKWARD_PRINT:
@@ -420,27 +638,23 @@ int main( int argc, char **argv)
 			case SEARCH:
 				input_word(word);
 				
-				pWord = createWord( word);
+				key.word = word;
 
-				if (searchNode( list, pWord, &ptr)) print_word( ptr);
+				if (searchNode( list, &key, &ptr)) print_word( ptr);
 				else fprintf( stdout, "%s not found\n", word);
-				
-				destroyWord( pWord);
 				break;
 				
 			case DELETE:
 				input_word(word);
 				
-				pWord = createWord( word);
+				key.word = word;
 
-				if (removeNode( list, pWord, &ptr))
+				if (removeNode( list, &key, &ptr))
 				{
 					fprintf( stdout, "(%s, %d) deleted\n", ptr->word, ptr->freq);
 					destroyWord( ptr);
 				}
 				else fprintf( stdout, "%s not found\n", word);
-				
-				destroyWord( pWord);
 				break;
 			
 			case COUNT:
@@ -448,6 +662,10 @@ int main( int argc, char **argv)
 				break;
 		}
 		
+		// printf 출력과 print_word(out_Stdout) 출력의 순서 유지
+		fflush( stdout);
+		out_Flush( out_Stdout());
+		
 		if (action) fprintf( stderr, "Select Q)uit, P)rint, B)ackward print, S)earch, D)elete, C)ount: ");
 	}
 	return 0;
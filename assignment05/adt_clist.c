@@ -0,0 +1,260 @@
+#include <stdlib.h> // malloc
+#include <sched.h> // sched_yield
+
+#include "adt_clist.h"
+
+// thread마다 쓰는 reader 카운터 (처음 읽을 때 차례로 배정)
+static atomic_uint next_stripe;
+static _Thread_local int my_stripe = -1;
+
+// 읽기 구간 시작 (이 구간에서 얻은 노드와 데이터는 readUnlockList 전까지 해제되지 않음)
+// return	readUnlockList에 넘길 값
+int readLockList( LIST *pList){
+	int stripe, idx;
+
+	if (my_stripe < 0) my_stripe = atomic_fetch_add(&next_stripe, 1) % CLIST_STRIPES;
+	stripe = my_stripe;
+
+	// 카운터를 올린 뒤의 읽기는 writer의 epoch 변경과 순서가 정해짐 (seq_cst)
+	idx = atomic_load(&pList->epoch) & 1;
+	atomic_fetch_add(&pList->readers[stripe].active[idx], 1);
+
+	return stripe * 2 + idx;
+}
+
+// 읽기 구간 끝
+void readUnlockList( LIST *pList, int token){
+	atomic_fetch_sub_explicit(&pList->readers[token / 2].active[token % 2], 1, memory_order_release);
+}
+
+// internal function
+// epoch의 홀짝 idx로 시작한 읽기 구간이 모두 끝날 때까지 대기
+static void _wait_readers(LIST *pList, int idx) {
+	for (;;) {
+		long active = 0;
+
+		for (int i = 0; i < CLIST_STRIPES; i++)
+			active += atomic_load_explicit(&pList->readers[i].active[idx], memory_order_acquire);
+		if (active == 0) return;
+		sched_yield();
+	}
+}
+
+// internal function
+// grace period: 호출 전에 연결을 끊은 노드를 볼 수 있는 읽기 구간이 모두 끝날 때까지 대기
+// epoch를 읽은 직후 지연된 reader가 이전 홀짝에 들어올 수 있으므로 두 번 바꿈
+// 두 번 바꾸는 동안 sync mutex를 잡아, 다른 removeNode의 변경이 끼어들어 같은 홀짝만 두 번 기다리지 않게 함
+static void _synchronize(LIST *pList) {
+	pthread_mutex_lock(&pList->sync);
+	for (int i = 0; i < 2; i++) {
+		unsigned int old = atomic_fetch_add(&pList->epoch, 1);
+		_wait_readers(pList, old & 1);
+	}
+	pthread_mutex_unlock(&pList->sync);
+}
+
+// internal insert function
+// inserts data into list
+// 새 노드의 연결을 먼저 채우고 앞 노드(또는 head)에 공개하므로, reader는 완성된 노드만 봄
+// for addNode function
+// return	1 if successful
+// 			0 if memory overflow
+static int _insert(LIST *pList, NODE *pPre, NODE *pNext, void *dataInPtr) {
+	NODE *pNew = (NODE *)malloc(sizeof(NODE));
+	if (pNew == NULL) return 0;
+
+	pNew->dataPtr = dataInPtr;
+	atomic_init(&pNew->llink, pPre);
+	atomic_init(&pNew->rlink, pNext);
+
+	// 정방향 공개
+	if (pPre == NULL) atomic_store_explicit(&pList->head, pNew, memory_order_release);
+	else atomic_store_explicit(&pPre->rlink, pNew, memory_order_release);
+
+	// 역방향 공개
+	if (pNext == NULL) atomic_store_explicit(&pList->rear, pNew, memory_order_release);
+	else atomic_store_explicit(&pNext->llink, pNew, memory_order_release);
+
+	atomic_fetch_add_explicit(&pList->count, 1, memory_order_relaxed);
+	return 1;
+}
+
+// internal delete function
+// unlinks node from list (노드 자신의 연결은 그대로 두어 노드에 있는 reader가 계속 진행할 수 있음)
+// for removeNode function
+static void _delete(LIST *pList, NODE *pLoc) {
+	NODE *pPre = atomic_load_explicit(&pLoc->llink, memory_order_relaxed);
+	NODE *pNext = atomic_load_explicit(&pLoc->rlink, memory_order_relaxed);
+
+	if (pPre == NULL) atomic_store_explicit(&pList->head, pNext, memory_order_release);
+	else atomic_store_explicit(&pPre->rlink, pNext, memory_order_release);
+
+	if (pNext == NULL) atomic_store_explicit(&pList->rear, pPre, memory_order_release);
+	else atomic_store_explicit(&pNext->llink, pPre, memory_order_release);
+
+	atomic_fetch_sub_explicit(&pList->count, 1, memory_order_relaxed);
+}
+
+// internal search function
+// searches list and passes back address of node containing target and its logical predecessor
+// 읽기 구간 또는 writer mutex 안에서 호출
+// for addNode, removeNode, searchNode functions
+// return	1 found
+// 			0 not found
+static int _search(LIST *pList, NODE **pPre, NODE **pLoc, void *pArgu) {
+	int cmp = 1;
+
+	*pPre = NULL;
+	*pLoc = atomic_load_explicit(&pList->head, memory_order_acquire);
+
+	while (*pLoc != NULL && (cmp = pList->compare(pArgu, (*pLoc)->dataPtr)) > 0) {
+		*pPre = *pLoc;
+		*pLoc = atomic_load_explicit(&(*pLoc)->rlink, memory_order_acquire);
+	}
+
+	return (*pLoc != NULL && cmp == 0);
+}
+
+// Allocates dynamic memory for a list head node and returns its address to caller
+// return	head node pointer
+// 			NULL if overflow
+LIST *createList( int (*compare)(const void *, const void *)){
+	LIST *mylist = (LIST *)malloc(sizeof(LIST));
+
+	if (mylist == NULL) return NULL;
+
+	if (pthread_mutex_init(&mylist->writer, NULL) != 0) {
+		free(mylist);
+		return NULL;
+	}
+	if (pthread_mutex_init(&mylist->sync, NULL) != 0) {
+		pthread_mutex_destroy(&mylist->writer);
+		free(mylist);
+		return NULL;
+	}
+	atomic_init(&mylist->count, 0);
+	atomic_init(&mylist->head, NULL);
+	atomic_init(&mylist->rear, NULL);
+	atomic_init(&mylist->epoch, 0);
+	for (int i = 0; i < CLIST_STRIPES; i++) {
+		atomic_init(&mylist->readers[i].active[0], 0);
+		atomic_init(&mylist->readers[i].active[1], 0);
+	}
+	mylist->compare = compare;
+
+	return mylist;
+}
+
+//  이름 리스트에 할당된 메모리를 해제 (head node, data node)
+// 다른 thread가 리스트를 쓰지 않을 때만 호출
+void destroyList( LIST *pList, void (*callback)(void *)){
+	NODE *current = atomic_load(&pList->head);
+
+	while (current != NULL) {
+		NODE *next = atomic_load(&current->rlink);
+
+		callback(current->dataPtr);
+		free(current);
+		current = next;
+	}
+	pthread_mutex_destroy(&pList->writer);
+	pthread_mutex_destroy(&pList->sync);
+	free(pList);
+}
+
+// Inserts data into list
+// callback은 이미 리스트에 존재하는 데이터를 발견했을 때 호출하는 함수 (writer mutex 안에서 호출)
+//	return	0 if overflow
+//			1 if successful
+//			2 if duplicated key
+int addNode( LIST *pList, void *dataInPtr, void (*callback)(const void *)){
+	NODE *pPre, *pLoc;
+	int ret;
+
+	pthread_mutex_lock(&pList->writer);
+
+	if (_search(pList, &pPre, &pLoc, dataInPtr)) { //리스트에 이미 존재하는 노드
+		callback(pLoc->dataPtr);
+		ret = 2;
+	}
+	else ret = _insert(pList, pPre, pLoc, dataInPtr); //실패하면 0
+
+	pthread_mutex_unlock(&pList->writer);
+	return ret;
+}
+
+// Removes data from list
+// 진행 중인 읽기 구간이 모두 끝날 때까지 기다린 뒤 돌아옴
+//	return	0 not found
+//			1 deleted
+int removeNode( LIST *pList, void *keyPtr, void **dataOutPtr){
+	NODE *pPre, *pLoc;
+
+	pthread_mutex_lock(&pList->writer);
+
+	if (!_search(pList, &pPre, &pLoc, keyPtr)) {
+		pthread_mutex_unlock(&pList->writer);
+		return 0;
+	}
+	_delete(pList, pLoc);
+
+	pthread_mutex_unlock(&pList->writer);
+
+	// 삭제한 노드를 보고 있을 수 있는 reader가 모두 나간 뒤 해제
+	_synchronize(pList);
+
+	*dataOutPtr = pLoc->dataPtr;
+	free(pLoc);
+	return 1;
+}
+
+// interface to search function
+//	pArgu	key being sought
+//	dataOutPtr	contains found data
+//	return	1 successful
+//			0 not found
+int searchNode( LIST *pList, void *pArgu, void **dataOutPtr){
+	NODE *pPre, *pLoc;
+	int token = readLockList(pList);
+	int found = _search(pList, &pPre, &pLoc, pArgu);
+
+	if (found) *dataOutPtr = pLoc->dataPtr;
+
+	readUnlockList(pList, token);
+	return found;
+}
+
+// returns number of nodes in list
+int countList( LIST *pList){
+	return atomic_load_explicit(&pList->count, memory_order_relaxed);
+}
+
+// returns	1 empty
+//			0 list has data
+int emptyList( LIST *pList){
+	return countList(pList) == 0 ? 1 : 0;
+}
+
+// traverses data from list (forward)
+void traverseList( LIST *pList, void (*callback)(const void *)){
+	int token = readLockList(pList);
+	NODE *pLoc = atomic_load_explicit(&pList->head, memory_order_acquire);
+
+	while (pLoc != NULL) {
+		callback(pLoc->dataPtr);
+		pLoc = atomic_load_explicit(&pLoc->rlink, memory_order_acquire);
+	}
+	readUnlockList(pList, token);
+}
+
+// traverses data from list (backward)
+void traverseListR( LIST *pList, void (*callback)(const void *)){
+	int token = readLockList(pList);
+	NODE *pLoc = atomic_load_explicit(&pList->rear, memory_order_acquire);
+
+	while (pLoc != NULL) {
+		callback(pLoc->dataPtr);
+		pLoc = atomic_load_explicit(&pLoc->llink, memory_order_acquire);
+	}
+	readUnlockList(pList, token);
+}
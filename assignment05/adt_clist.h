@@ -0,0 +1,104 @@
+#include <stdatomic.h> // _Atomic
+#include <pthread.h> // pthread_mutex_t
+
+////////////////////////////////////////////////////////////////////////////////
+// concurrent doubly linked list
+// adt_dlist.h와 같은 함수(createList, addNode, removeNode, searchNode, traverseList, ...)를 제공하며,
+// 여러 thread가 탐색/순회하는 동안 다른 thread가 삽입/삭제할 수 있음
+//
+// - 읽기 (searchNode, traverseList, traverseListR, countList, emptyList)
+//   lock 없이 연결을 따라감 (writer를 기다리지 않음)
+//   읽기 구간에 들어갈 때와 나올 때 reader 카운터만 증가/감소
+// - 쓰기 (addNode, removeNode)
+//   writer mutex로 직렬화, 새 노드는 연결을 모두 채운 뒤 앞 노드에 공개
+//   삭제한 노드는 연결만 끊고, 그 전에 시작한 읽기 구간이 모두 끝난 뒤(grace period) 해제
+//   (SRCU 방식: epoch를 바꾸고 이전 epoch의 reader 카운터가 0이 될 때까지 대기, 두 번 반복)
+//   grace period는 writer mutex 밖에서 기다리므로(그동안 addNode는 진행) sync mutex로 따로 직렬화
+//   (여러 thread가 동시에 삭제할 때 epoch 변경이 섞여 한쪽 홀짝만 두 번 기다리는 일이 없도록)
+//
+// 순회는 각 노드를 한 번씩 방문하지만, 순회 중에 삽입/삭제된 노드는 보일 수도 있고 안 보일 수도 있음
+// searchNode가 돌려준 데이터를 계속 쓰려면 readLockList/readUnlockList로 감싸야 함
+// (removeNode가 돌려준 데이터는 읽는 thread가 없으므로 바로 해제할 수 있음)
+// 읽기 구간 안에서 addNode, removeNode를 호출하면 안 됨 (자기 자신을 기다림)
+
+#define CLIST_STRIPES	16	// reader 카운터 수 (thread마다 나누어 cache line 경합을 줄임)
+
+////////////////////////////////////////////////////////////////////////////////
+// LIST type definition
+typedef struct node
+{
+	void				*dataPtr;
+	_Atomic(struct node *)	llink;
+	_Atomic(struct node *)	rlink;
+} NODE;
+
+// 읽기 구간에 있는 reader 수 (epoch의 홀짝별)
+typedef struct
+{
+	atomic_long	active[2];
+	char		pad[64 - 2 * sizeof(atomic_long)]; // 다른 카운터와 cache line을 나누지 않음
+} READERS;
+
+typedef struct
+{
+	atomic_int		count;
+	_Atomic(NODE *)	head;
+	_Atomic(NODE *)	rear;
+	int				(*compare)(const void *, const void *); // used in _search function
+	pthread_mutex_t	writer; // addNode, removeNode 직렬화
+	pthread_mutex_t	sync; // removeNode의 grace period 직렬화 (epoch를 두 번 바꾸는 동안 유지)
+	atomic_uint		epoch;
+	READERS			readers[CLIST_STRIPES];
+} LIST;
+
+////////////////////////////////////////////////////////////////////////////////
+// function declarations
+
+// Allocates dynamic memory for a list head node and returns its address to caller
+// return	head node pointer
+// 			NULL if overflow
+LIST *createList( int (*compare)(const void *, const void *));
+
+//  이름 리스트에 할당된 메모리를 해제 (head node, data node)
+// 다른 thread가 리스트를 쓰지 않을 때만 호출
+void destroyList( LIST *pList, void (*callback)(void *));
+
+// Inserts data into list
+// callback은 이미 리스트에 존재하는 데이터를 발견했을 때 호출하는 함수 (writer mutex 안에서 호출)
+//	return	0 if overflow
+//			1 if successful
+//			2 if duplicated key
+int addNode( LIST *pList, void *dataInPtr, void (*callback)(const void *));
+
+// Removes data from list
+// 진행 중인 읽기 구간이 모두 끝날 때까지 기다린 뒤 돌아옴
+//	return	0 not found
+//			1 deleted
+int removeNode( LIST *pList, void *keyPtr, void **dataOutPtr);
+
+// interface to search function
+//	pArgu	key being sought
+//	dataOutPtr	contains found data
+//	return	1 successful
+//			0 not found
+int searchNode( LIST *pList, void *pArgu, void **dataOutPtr);
+
+// returns number of nodes in list
+int countList( LIST *pList);
+
+// returns	1 empty
+//			0 list has data
+int emptyList( LIST *pList);
+
+// traverses data from list (forward)
+void traverseList( LIST *pList, void (*callback)(const void *));
+
+// traverses data from list (backward)
+void traverseListR( LIST *pList, void (*callback)(const void *));
+
+// 읽기 구간 시작 (이 구간에서 얻은 노드와 데이터는 readUnlockList 전까지 해제되지 않음)
+// return	readUnlockList에 넘길 값
+int readLockList( LIST *pList);
+
+// 읽기 구간 끝
+void readUnlockList( LIST *pList, int token);
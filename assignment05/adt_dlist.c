@@ -2,6 +2,50 @@
 
 #include "adt_dlist.h"
 
+#define SLAB_MIN	64 // 첫 slab의 노드 수 (slab마다 두 배, SLAB_MAX까지)
+#define SLAB_MAX	4096
+
+// internal function
+// 노드 하나를 할당 (pool을 쓰면 반환된 노드, 현재 slab, 새 slab 순)
+// return	node pointer
+// 			NULL if overflow
+static NODE *_alloc_node(LIST *pList) {
+    SLAB *slab = pList->slabs;
+
+    if (!pList->pooled) return (NODE *)malloc(sizeof(NODE));
+
+    if (pList->freeNodes != NULL) {
+        NODE *pNode = pList->freeNodes;
+        pList->freeNodes = pNode->rlink;
+        return pNode;
+    }
+
+    if (slab == NULL || slab->used == slab->capacity) {
+        int capacity = (slab == NULL) ? SLAB_MIN : slab->capacity * 2;
+        if (capacity > SLAB_MAX) capacity = SLAB_MAX;
+
+        slab = (SLAB *)malloc(sizeof(SLAB) + capacity * sizeof(NODE));
+        if (slab == NULL) return NULL;
+
+        slab->next = pList->slabs;
+        slab->used = 0;
+        slab->capacity = capacity;
+        pList->slabs = slab;
+    }
+    return &slab->nodes[slab->used++];
+}
+
+// internal function
+// 노드 하나를 해제 (pool을 쓰면 재사용 목록에 넣음)
+static void _free_node(LIST *pList, NODE *pNode) {
+    if (!pList->pooled) {
+        free(pNode);
+        return;
+    }
+    pNode->rlink = pList->freeNodes;
+    pList->freeNodes = pNode;
+}
+
 // internal insert function
 // inserts data into list
 // for addNode function
@@ -9,7 +53,7 @@
 // 			0 if memory overflow
 static int _insert(LIST *pList, NODE *pPre, void *dataInPtr) {
 	
-    NODE *pNew = (NODE *)malloc(sizeof(NODE));
+    NODE *pNew = _alloc_node(pList);
     if (pNew == NULL) return 0;
 
     pNew->llink = NULL;
@@ -35,6 +79,7 @@ static int _insert(LIST *pList, NODE *pPre, void *dataInPtr) {
     }
 
     (pList->count)++;
+    pList->finger = pNew;
     return 1;
 }
 
@@ -45,6 +90,8 @@ static void _delete(LIST *pList, NODE *pPre, NODE *pLoc, void **dataOutPtr) {
 
     *dataOutPtr = pLoc->dataPtr;
 
+    if (pList->finger == pLoc) pList->finger = (pPre != NULL) ? pPre : pLoc->rlink;
+
 	//선행자 유무
     if (pPre != NULL) { 
         pPre->rlink = pLoc->rlink;
@@ -59,10 +106,59 @@ static void _delete(LIST *pList, NODE *pPre, NODE *pLoc, void **dataOutPtr) {
         pList->rear = pPre;
     }
 
-    free(pLoc);
+    _free_node(pList, pLoc);
     (pList->count)--;
 }
 
+// internal search function
+// 정렬되지 않은 리스트에서 같은 데이터를 찾음 (LIST_MTF, LIST_TRANSPOSE)
+// 찾지 못하면 *pPre는 rear (끝에 추가)
+static int _search_unordered(LIST *pList, NODE **pPre, NODE **pLoc, void *pArgu) {
+
+    *pPre = NULL;
+    *pLoc = pList->head;
+
+    while (*pLoc != NULL) {
+        if (pList->compare(pArgu, (*pLoc)->dataPtr) == 0) return 1;
+        *pPre = *pLoc;
+        *pLoc = (*pLoc)->rlink;
+    }
+    return 0;
+}
+
+// internal search function
+// finger에서 시작하여 대상 쪽으로 앞 또는 뒤로 이동 (정렬 리스트)
+static int _search_finger(LIST *pList, NODE **pPre, NODE **pLoc, void *pArgu) {
+    NODE *pCur = pList->finger;
+    int cmp = pList->compare(pArgu, pCur->dataPtr);
+
+    if (cmp > 0) { //finger 뒤쪽: 대상 이상인 첫 노드까지 앞으로
+        *pPre = pCur;
+        *pLoc = pCur->rlink;
+        while (*pLoc != NULL && (cmp = pList->compare(pArgu, (*pLoc)->dataPtr)) > 0) {
+            *pPre = *pLoc;
+            *pLoc = (*pLoc)->rlink;
+        }
+        return (*pLoc != NULL && cmp == 0);
+    }
+
+    //finger 앞쪽 (또는 finger): 대상 이하인 첫 노드까지 뒤로
+    while (cmp < 0 && pCur->llink != NULL) {
+        cmp = pList->compare(pArgu, pCur->llink->dataPtr);
+        if (cmp <= 0) pCur = pCur->llink;
+        if (cmp == 0) break;
+    }
+    if (cmp == 0) {
+        *pPre = pCur->llink;
+        *pLoc = pCur;
+        return 1;
+    }
+    //pCur는 대상보다 큰 노드 중 가장 앞의 노드
+    *pPre = pCur->llink;
+    *pLoc = pCur;
+    return 0;
+}
+
 // internal search function
 // searches list and passes back address of node containing target and its logical predecessor
 // for addNode, removeNode, searchNode functions
@@ -70,6 +166,29 @@ static void _delete(LIST *pList, NODE *pPre, NODE *pLoc, void **dataOutPtr) {
 // 			0 not found
 static int _search(LIST *pList, NODE **pPre, NODE **pLoc, void *pArgu) {
 	
+    if (pList->mode == LIST_MTF || pList->mode == LIST_TRANSPOSE)
+        return _search_unordered(pList, pPre, pLoc, pArgu);
+
+    // 맨 뒤 또는 맨 앞이면 바로 결정 (정렬된 입력은 항상 맨 뒤에 추가되므로 O(1))
+    if (pList->rear != NULL) {
+        int cmp = pList->compare(pArgu, pList->rear->dataPtr);
+
+        if (cmp >= 0) {
+            *pPre = (cmp > 0) ? pList->rear : pList->rear->llink;
+            *pLoc = (cmp > 0) ? NULL : pList->rear;
+            return (cmp == 0);
+        }
+        if (pList->head != pList->rear && (cmp = pList->compare(pArgu, pList->head->dataPtr)) <= 0) {
+            *pPre = NULL;
+            *pLoc = pList->head;
+            return (cmp == 0);
+        }
+    }
+
+    // 마지막으로 삽입한(LIST_FINGER는 접근한) 노드에서 앞 또는 뒤로 탐색
+    if (pList->finger != NULL)
+        return _search_finger(pList, pPre, pLoc, pArgu);
+
     *pPre = NULL;
     *pLoc = pList->head;
 
@@ -88,6 +207,34 @@ static int _search(LIST *pList, NODE **pPre, NODE **pLoc, void *pArgu) {
     }
 }
 
+// internal function
+// 찾은 노드를 mode에 따라 정리 (finger 갱신, 맨 앞 또는 한 칸 앞으로 이동)
+// for addNode, searchNode functions
+// return	데이터가 들어 있는 노드
+static NODE *_access(LIST *pList, NODE *pPre, NODE *pLoc) {
+
+    if (pList->mode == LIST_MTF && pPre != NULL) { //맨 앞으로 다시 연결
+        pPre->rlink = pLoc->rlink;
+        if (pLoc->rlink != NULL) pLoc->rlink->llink = pPre;
+        else pList->rear = pPre;
+
+        pLoc->llink = NULL;
+        pLoc->rlink = pList->head;
+        pList->head->llink = pLoc;
+        pList->head = pLoc;
+    }
+    else if (pList->mode == LIST_TRANSPOSE && pPre != NULL) { //앞 노드와 데이터를 맞바꿈
+        void *dataPtr = pPre->dataPtr;
+
+        pPre->dataPtr = pLoc->dataPtr;
+        pLoc->dataPtr = dataPtr;
+        pLoc = pPre;
+    }
+
+    if (pList->mode == LIST_FINGER) pList->finger = pLoc;
+    return pLoc;
+}
+
 // Allocates dynamic memory for a list head node and returns its address to caller
 // return	head node pointer
 // 			NULL if overflow
@@ -104,11 +251,42 @@ LIST *createList( int (*compare)(const void *, const void *)){
 	mylist->head=NULL;
 	mylist->rear=NULL;
 	mylist->compare=compare;
+	mylist->mode=LIST_SORTED;
+	mylist->finger=NULL;
+	mylist->pooled=0;
+	mylist->slabs=NULL;
+	mylist->freeNodes=NULL;
 	}
 	
 	return mylist;
 }
 
+// createList와 같으나 노드를 리스트가 가진 pool에서 할당
+// 노드는 slab 단위로 할당하여 삽입 순서대로 연속 배치하고, removeNode로 삭제된 노드는 재사용
+// destroyList는 노드를 하나씩 해제하지 않고 slab만 해제
+// return	head node pointer
+// 			NULL if overflow
+LIST *createListPooled( int (*compare)(const void *, const void *)){
+	LIST *mylist = createList(compare);
+	
+	if (mylist != NULL) mylist->pooled = 1;
+	
+	return mylist;
+}
+
+// createList와 같으나 탐색 방식을 지정 (mode: LIST_SORTED, LIST_FINGER, LIST_MTF, LIST_TRANSPOSE)
+// LIST_MTF, LIST_TRANSPOSE는 정렬하지 않으므로 compare는 같은지만 판단하고,
+// traverseList는 현재 리스트 순서(자주 찾은 데이터가 앞쪽)로 순회
+// return	head node pointer
+// 			NULL if overflow
+LIST *createListMode( int (*compare)(const void *, const void *), int mode){
+	LIST *mylist = createList(compare);
+	
+	if (mylist != NULL) mylist->mode = mode;
+	
+	return mylist;
+}
+
 //  이름 리스트에 할당된 메모리를 해제 (head node, data node)
 void destroyList( LIST *pList, void (*callback)(void *)){
 		NODE *current= pList-> head;
@@ -117,9 +295,16 @@ void destroyList( LIST *pList, void (*callback)(void *)){
 		while(current!=NULL){
 			next=current->rlink;
 			callback(current->dataPtr); //callback함수로 처리
-			free(current);
+			if(!pList->pooled) free(current);
 			current=next;
 		}
+		
+		// pool을 쓰면 노드는 slab과 함께 한 번에 해제
+		while(pList->slabs!=NULL){
+			SLAB *slab=pList->slabs;
+			pList->slabs=slab->next;
+			free(slab);
+		}
 	pList->head=NULL; //빈 리스트임을 명시
 	free(pList); //리스트구조체 메모리 해제
 }
@@ -134,6 +319,7 @@ int addNode( LIST *pList, void *dataInPtr, void (*callback)(const void *)){
 	NODE *pPre, *pLoc;
 	
 	if(_search(pList, &pPre, &pLoc, dataInPtr)){ //리스트에 이미 존재하는 노드
+		pLoc = _access(pList, pPre, pLoc);
 		callback(pLoc->dataPtr); //addNode에서 빈도 증가시킬 때 쓰임
 		return 2;
 	}
@@ -168,6 +354,7 @@ int searchNode( LIST *pList, void *pArgu, void **dataOutPtr){
 	
 	if(!_search(pList, &pPre, &pLoc, pArgu)) return 0;
 	
+	pLoc = _access(pList, pPre, pLoc);
 	*dataOutPtr=pLoc->dataPtr;
 	
 	return 1;
@@ -1,4 +1,11 @@
 
+////////////////////////////////////////////////////////////////////////////////
+// list mode (createListMode)
+#define LIST_SORTED		0	// compare 순으로 정렬 (createList), 마지막으로 삽입한 노드(finger)에서 앞/뒤로 탐색
+#define LIST_FINGER		1	// LIST_SORTED와 같으나 탐색으로 찾은 노드도 finger가 됨
+#define LIST_MTF		2	// 정렬하지 않음 (끝에 추가), 찾은 노드를 맨 앞으로 이동 (move-to-front)
+#define LIST_TRANSPOSE	3	// 정렬하지 않음 (끝에 추가), 찾은 노드를 한 칸 앞으로 이동
+
 ////////////////////////////////////////////////////////////////////////////////
 // LIST type definition
 typedef struct node
@@ -8,12 +15,27 @@ typedef struct node
 	struct node	*rlink;
 } NODE;
 
+// 노드 pool의 한 덩어리 (createListPooled)
+// 노드를 삽입 순서대로 연속된 메모리에서 꺼내 씀
+typedef struct slab
+{
+	struct slab	*next;
+	int			used; // 꺼내 쓴 노드 수
+	int			capacity;
+	NODE		nodes[];
+} SLAB;
+
 typedef struct
 {
 	int		count;
 	NODE	*head;
 	NODE	*rear;
 	int		(*compare)(const void *, const void *); // used in _search function
+	int		mode; // LIST_SORTED, LIST_FINGER, LIST_MTF, LIST_TRANSPOSE
+	NODE	*finger; // 마지막으로 삽입한 노드 (LIST_FINGER는 마지막으로 접근한 노드)
+	int		pooled; // 1: 노드를 pool에서 할당 (createListPooled)
+	SLAB	*slabs; // 할당한 slab 목록 (가장 최근 것이 처음)
+	NODE	*freeNodes; // removeNode로 반환된 노드 (rlink로 연결)
 } LIST;
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +46,20 @@ typedef struct
 // 			NULL if overflow
 LIST *createList( int (*compare)(const void *, const void *));
 
+// createList와 같으나 노드를 리스트가 가진 pool에서 할당
+// 노드는 slab 단위로 할당하여 삽입 순서대로 연속 배치하고, removeNode로 삭제된 노드는 재사용
+// destroyList는 노드를 하나씩 해제하지 않고 slab만 해제
+// return	head node pointer
+// 			NULL if overflow
+LIST *createListPooled( int (*compare)(const void *, const void *));
+
+// createList와 같으나 탐색 방식을 지정 (mode: LIST_SORTED, LIST_FINGER, LIST_MTF, LIST_TRANSPOSE)
+// LIST_MTF, LIST_TRANSPOSE는 정렬하지 않으므로 compare는 같은지만 판단하고,
+// traverseList는 현재 리스트 순서(자주 찾은 데이터가 앞쪽)로 순회
+// return	head node pointer
+// 			NULL if overflow
+LIST *createListMode( int (*compare)(const void *, const void *), int mode);
+
 //  이름 리스트에 할당된 메모리를 해제 (head node, data node)
 void destroyList( LIST *pList, void (*callback)(void *));
 
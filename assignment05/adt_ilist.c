@@ -0,0 +1,182 @@
+#include <stdlib.h> // malloc
+
+#include "adt_ilist.h"
+
+// internal insert function
+// links an element after pPre (pPre가 NULL이면 맨 앞)
+// for ilist_Add function
+static void _insert(ILIST *pList, ILINK *pPre, ILINK *pNew) {
+	pNew->llink = pPre;
+
+	if (pPre == NULL) {
+		pNew->rlink = pList->head;
+		pList->head = pNew;
+	} else {
+		pNew->rlink = pPre->rlink;
+		pPre->rlink = pNew;
+	}
+
+	if (pNew->rlink != NULL) pNew->rlink->llink = pNew;
+	else pList->rear = pNew;
+
+	(pList->count)++;
+	pList->finger = pNew;
+}
+
+// internal delete function
+// unlinks an element from list
+// for ilist_Remove function
+static void _delete(ILIST *pList, ILINK *pLoc) {
+	if (pList->finger == pLoc) pList->finger = (pLoc->llink != NULL) ? pLoc->llink : pLoc->rlink;
+
+	if (pLoc->llink != NULL) pLoc->llink->rlink = pLoc->rlink;
+	else pList->head = pLoc->rlink;
+
+	if (pLoc->rlink != NULL) pLoc->rlink->llink = pLoc->llink;
+	else pList->rear = pLoc->llink;
+
+	pLoc->llink = NULL;
+	pLoc->rlink = NULL;
+	(pList->count)--;
+}
+
+// internal search function
+// searches list and passes back address of element containing target and its logical predecessor
+// rear, head를 먼저 비교하고, 그 사이이면 finger에서 앞 또는 뒤로 탐색
+// for ilist_Add, ilist_Remove, ilist_Search functions
+// return	1 found
+// 			0 not found
+static int _search(ILIST *pList, ILINK **pPre, ILINK **pLoc, const ILINK *pArgu) {
+	ILINK *pCur;
+	int cmp;
+
+	*pPre = NULL;
+	*pLoc = pList->head;
+	if (pList->rear == NULL) return 0;
+
+	// 맨 뒤 또는 맨 앞
+	cmp = pList->compare(pArgu, pList->rear);
+	if (cmp >= 0) {
+		*pPre = (cmp > 0) ? pList->rear : pList->rear->llink;
+		*pLoc = (cmp > 0) ? NULL : pList->rear;
+		return (cmp == 0);
+	}
+	if ((cmp = pList->compare(pArgu, pList->head)) <= 0) return (cmp == 0);
+
+	// finger 뒤쪽: 대상 이상인 첫 원소까지 앞으로
+	pCur = pList->finger;
+	cmp = pList->compare(pArgu, pCur);
+	if (cmp > 0) {
+		*pPre = pCur;
+		*pLoc = pCur->rlink;
+		while ((cmp = pList->compare(pArgu, *pLoc)) > 0) { // rear보다 작으므로 NULL에 도달하지 않음
+			*pPre = *pLoc;
+			*pLoc = (*pLoc)->rlink;
+		}
+		return (cmp == 0);
+	}
+
+	// finger 앞쪽: 대상 이하인 첫 원소까지 뒤로 (head보다 크므로 head에서 멈춤)
+	while (cmp < 0) {
+		cmp = pList->compare(pArgu, pCur->llink);
+		if (cmp <= 0) pCur = pCur->llink;
+	}
+	*pPre = pCur->llink;
+	*pLoc = pCur;
+	return (cmp == 0);
+}
+
+// Allocates dynamic memory for a list head node and returns its address to caller
+// compare는 두 원소의 ILINK를 받음 (ilist_Entry로 원소를 구함)
+// return	head node pointer
+// 			NULL if overflow
+ILIST *ilist_Create( int (*compare)(const ILINK *, const ILINK *)){
+	ILIST *pList = (ILIST *)malloc(sizeof(ILIST));
+
+	if (pList == NULL) return NULL;
+
+	pList->count = 0;
+	pList->head = NULL;
+	pList->rear = NULL;
+	pList->finger = NULL;
+	pList->compare = compare;
+
+	return pList;
+}
+
+// 리스트를 해제 (원소는 callback으로 넘기며, callback이 NULL이면 원소는 그대로 둠)
+void ilist_Destroy( ILIST *pList, void (*callback)(ILINK *)){
+	ILINK *pCur = pList->head;
+
+	while (callback != NULL && pCur != NULL) {
+		ILINK *pNext = pCur->rlink;
+
+		callback(pCur);
+		pCur = pNext;
+	}
+	free(pList);
+}
+
+// Inserts an element into list (할당하지 않으므로 실패하지 않음)
+// callback은 이미 리스트에 존재하는 원소를 발견했을 때 호출하는 함수
+//	return	1 if successful
+//			2 if duplicated key (link는 연결되지 않음)
+int ilist_Add( ILIST *pList, ILINK *link, void (*callback)(ILINK *)){
+	ILINK *pPre, *pLoc;
+
+	if (_search(pList, &pPre, &pLoc, link)) {
+		callback(pLoc);
+		return 2;
+	}
+
+	_insert(pList, pPre, link);
+	return 1;
+}
+
+// Removes an element from list (원소의 메모리는 해제하지 않음)
+//	return	0 not found
+//			1 deleted
+int ilist_Remove( ILIST *pList, const ILINK *key, ILINK **linkOut){
+	ILINK *pPre, *pLoc;
+
+	if (!_search(pList, &pPre, &pLoc, key)) return 0;
+
+	_delete(pList, pLoc);
+	*linkOut = pLoc;
+	return 1;
+}
+
+// interface to search function
+//	key		key being sought (원소와 같은 구조체의 ILINK)
+//	linkOut	contains found element
+//	return	1 successful
+//			0 not found
+int ilist_Search( ILIST *pList, const ILINK *key, ILINK **linkOut){
+	ILINK *pPre, *pLoc;
+
+	if (!_search(pList, &pPre, &pLoc, key)) return 0;
+
+	*linkOut = pLoc;
+	return 1;
+}
+
+// returns number of elements in list
+int ilist_Count( ILIST *pList){
+	return pList->count;
+}
+
+// returns	1 empty
+//			0 list has data
+int ilist_Empty( ILIST *pList){
+	return pList->count == 0 ? 1 : 0;
+}
+
+// traverses elements from list (forward)
+void ilist_Traverse( ILIST *pList, void (*callback)(const ILINK *)){
+	for (ILINK *pLoc = pList->head; pLoc != NULL; pLoc = pLoc->rlink) callback(pLoc);
+}
+
+// traverses elements from list (backward)
+void ilist_TraverseR( ILIST *pList, void (*callback)(const ILINK *)){
+	for (ILINK *pLoc = pList->rear; pLoc != NULL; pLoc = pLoc->llink) callback(pLoc);
+}
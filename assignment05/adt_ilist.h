@@ -0,0 +1,79 @@
+#include <stddef.h> // offsetof
+
+////////////////////////////////////////////////////////////////////////////////
+// intrusive doubly linked list
+// adt_dlist와 같은 정렬 리스트이나, 노드를 따로 할당하지 않고 사용자 구조체 안에 ILINK를 넣어 연결
+// 원소마다 할당이 한 번이고, 비교할 때 dataPtr을 한 번 더 따라가지 않음
+//
+//	typedef struct {
+//		char	*word;
+//		int		freq;
+//		ILINK	link;	// list hook
+//	} tWord;
+//
+//	tWord *w = ilist_Entry( pLink, tWord, link);
+
+////////////////////////////////////////////////////////////////////////////////
+// LIST type definition
+typedef struct ilink
+{
+	struct ilink	*llink;
+	struct ilink	*rlink;
+} ILINK;
+
+typedef struct
+{
+	int		count;
+	ILINK	*head;
+	ILINK	*rear;
+	ILINK	*finger; // 마지막으로 삽입한 원소 (탐색 시작 위치)
+	int		(*compare)(const ILINK *, const ILINK *); // used in _search function
+} ILIST;
+
+// ILINK 포인터로부터 그것을 담고 있는 구조체의 포인터를 구함 (container_of)
+// ptr이 ILINK 포인터가 아니거나 member가 ILINK가 아니면 컴파일 경고
+#define ilist_Entry( ptr, type, member) \
+	((type *)((char *)(1 ? (ptr) : &((type *)0)->member) - offsetof(type, member)))
+
+////////////////////////////////////////////////////////////////////////////////
+// function declarations
+
+// Allocates dynamic memory for a list head node and returns its address to caller
+// compare는 두 원소의 ILINK를 받음 (ilist_Entry로 원소를 구함)
+// return	head node pointer
+// 			NULL if overflow
+ILIST *ilist_Create( int (*compare)(const ILINK *, const ILINK *));
+
+// 리스트를 해제 (원소는 callback으로 넘기며, callback이 NULL이면 원소는 그대로 둠)
+void ilist_Destroy( ILIST *pList, void (*callback)(ILINK *));
+
+// Inserts an element into list (할당하지 않으므로 실패하지 않음)
+// callback은 이미 리스트에 존재하는 원소를 발견했을 때 호출하는 함수
+//	return	1 if successful
+//			2 if duplicated key (link는 연결되지 않음)
+int ilist_Add( ILIST *pList, ILINK *link, void (*callback)(ILINK *));
+
+// Removes an element from list (원소의 메모리는 해제하지 않음)
+//	return	0 not found
+//			1 deleted
+int ilist_Remove( ILIST *pList, const ILINK *key, ILINK **linkOut);
+
+// interface to search function
+//	key		key being sought (원소와 같은 구조체의 ILINK)
+//	linkOut	contains found element
+//	return	1 successful
+//			0 not found
+int ilist_Search( ILIST *pList, const ILINK *key, ILINK **linkOut);
+
+// returns number of elements in list
+int ilist_Count( ILIST *pList);
+
+// returns	1 empty
+//			0 list has data
+int ilist_Empty( ILIST *pList);
+
+// traverses elements from list (forward)
+void ilist_Traverse( ILIST *pList, void (*callback)(const ILINK *));
+
+// traverses elements from list (backward)
+void ilist_TraverseR( ILIST *pList, void (*callback)(const ILINK *));
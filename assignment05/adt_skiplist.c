@@ -0,0 +1,232 @@
+#include <stdlib.h> // malloc
+
+#include "adt_skiplist.h"
+
+// internal function
+// 노드의 level을 정함 (level k 이상일 확률 1/4^(k-1))
+static int _random_level(LIST *pList) {
+	unsigned int x = pList->seed;
+	int level = 1;
+
+	// xorshift32
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	pList->seed = x;
+
+	// 하위 비트 2개씩 보며 모두 0이면 한 단계 올림
+	while ((x & 3) == 0 && level < SKIP_MAX_LEVEL) {
+		level++;
+		x >>= 2;
+	}
+	return level;
+}
+
+// internal function
+// level개의 rlink를 가진 노드를 할당
+// return	node pointer
+// 			NULL if overflow
+static NODE *_create_node(void *dataInPtr, int level) {
+	NODE *pNew = (NODE *)malloc(sizeof(NODE) + level * sizeof(NODE *));
+	if (pNew == NULL) return NULL;
+
+	pNew->dataPtr = dataInPtr;
+	pNew->llink = NULL;
+	pNew->level = level;
+	for (int i = 0; i < level; i++) pNew->rlink[i] = NULL;
+
+	return pNew;
+}
+
+// internal search function
+// 각 level에서 target보다 작은 마지막 노드를 update에 저장 (없으면 header 노드)
+// for addNode, removeNode functions
+// return	1 found (*pLoc는 target을 가진 노드)
+// 			0 not found (*pLoc는 target보다 큰 첫번째 노드 또는 NULL)
+static int _search(LIST *pList, NODE **update, NODE **pLoc, void *pArgu) {
+	NODE *pPre = pList->head;
+	NODE *pStop = NULL; // 위 level에서 비교하여 멈춘 노드 (아래 level에서 다시 비교하지 않음)
+	int stopCmp = -1; // pStop과의 비교 결과
+
+	for (int i = pList->level - 1; i >= 0; i--) {
+		NODE *pNext = pPre->rlink[i];
+		int cmp = -1;
+
+		while (pNext != NULL && pNext != pStop) {
+			if ((cmp = pList->compare(pArgu, pNext->dataPtr)) <= 0) break;
+			pPre = pNext;
+			pNext = pPre->rlink[i];
+		}
+		if (pNext != pStop) {
+			pStop = pNext;
+			stopCmp = cmp;
+		}
+		update[i] = pPre;
+	}
+
+	*pLoc = pStop;
+
+	return (*pLoc != NULL && stopCmp == 0);
+}
+
+// internal insert function
+// inserts data into list after the nodes in update
+// for addNode function
+// return	1 if successful
+// 			0 if memory overflow
+static int _insert(LIST *pList, NODE **update, void *dataInPtr) {
+	int level = _random_level(pList);
+	NODE *pNew = _create_node(dataInPtr, level);
+	if (pNew == NULL) return 0;
+
+	// 새로 생기는 level은 header 노드 다음에 연결
+	for (int i = pList->level; i < level; i++) update[i] = pList->head;
+	if (level > pList->level) pList->level = level;
+
+	for (int i = 0; i < level; i++) {
+		pNew->rlink[i] = update[i]->rlink[i];
+		update[i]->rlink[i] = pNew;
+	}
+
+	// 가장 아래 level의 역방향 연결
+	pNew->llink = (update[0] == pList->head) ? NULL : update[0];
+	if (pNew->rlink[0] != NULL) pNew->rlink[0]->llink = pNew;
+	else pList->rear = pNew;
+
+	(pList->count)++;
+	return 1;
+}
+
+// internal delete function
+// deletes data from list and saves the (deleted) data to dataOutPtr
+// for removeNode function
+static void _delete(LIST *pList, NODE **update, NODE *pLoc, void **dataOutPtr) {
+	*dataOutPtr = pLoc->dataPtr;
+
+	for (int i = 0; i < pLoc->level; i++) update[i]->rlink[i] = pLoc->rlink[i];
+
+	if (pLoc->rlink[0] != NULL) pLoc->rlink[0]->llink = pLoc->llink;
+	else pList->rear = pLoc->llink;
+
+	// 비게 된 위쪽 level 제거
+	while (pList->level > 1 && pList->head->rlink[pList->level - 1] == NULL) pList->level--;
+
+	free(pLoc);
+	(pList->count)--;
+}
+
+// Allocates dynamic memory for a list head node and returns its address to caller
+// return	head node pointer
+// 			NULL if overflow
+LIST *createList( int (*compare)(const void *, const void *)){
+	LIST *mylist = (LIST *)malloc(sizeof(LIST));
+
+	if (mylist == NULL) return NULL;
+
+	mylist->head = _create_node(NULL, SKIP_MAX_LEVEL);
+	if (mylist->head == NULL) {
+		free(mylist);
+		return NULL;
+	}
+
+	mylist->count = 0;
+	mylist->level = 1;
+	mylist->rear = NULL;
+	mylist->seed = 2463534242u; // 실행할 때마다 같은 구조 (재현 가능한 측정)
+	mylist->compare = compare;
+
+	return mylist;
+}
+
+//  이름 리스트에 할당된 메모리를 해제 (head node, data node)
+void destroyList( LIST *pList, void (*callback)(void *)){
+	NODE *current = pList->head->rlink[0];
+	NODE *next;
+
+	while (current != NULL) {
+		next = current->rlink[0];
+		callback(current->dataPtr);
+		free(current);
+		current = next;
+	}
+	free(pList->head);
+	free(pList);
+}
+
+// Inserts data into list
+// callback은 이미 리스트에 존재하는 데이터를 발견했을 때 호출하는 함수
+//	return	0 if overflow
+//			1 if successful
+//			2 if duplicated key
+int addNode( LIST *pList, void *dataInPtr, void (*callback)(const void *)){
+	NODE *update[SKIP_MAX_LEVEL];
+	NODE *pLoc;
+
+	if (_search(pList, update, &pLoc, dataInPtr)) { //리스트에 이미 존재하는 노드
+		callback(pLoc->dataPtr);
+		return 2;
+	}
+
+	if (!_insert(pList, update, dataInPtr)) return 0; //메모리 오버플로우
+
+	return 1;
+}
+
+// Removes data from list
+//	return	0 not found
+//			1 deleted
+int removeNode( LIST *pList, void *keyPtr, void **dataOutPtr){
+	NODE *update[SKIP_MAX_LEVEL];
+	NODE *pLoc;
+
+	if (!_search(pList, update, &pLoc, keyPtr)) return 0;
+
+	_delete(pList, update, pLoc, dataOutPtr);
+	return 1;
+}
+
+// interface to search function
+//	pArgu	key being sought
+//	dataOutPtr	contains found data
+//	return	1 successful
+//			0 not found
+int searchNode( LIST *pList, void *pArgu, void **dataOutPtr){
+	NODE *update[SKIP_MAX_LEVEL];
+	NODE *pLoc;
+
+	if (!_search(pList, update, &pLoc, pArgu)) return 0;
+
+	*dataOutPtr = pLoc->dataPtr;
+	return 1;
+}
+
+// returns number of nodes in list
+int countList( LIST *pList){
+	return pList->count;
+}
+
+// returns	1 empty
+//			0 list has data
+int emptyList( LIST *pList){
+	return pList->count == 0 ? 1 : 0;
+}
+
+// traverses data from list (forward)
+void traverseList( LIST *pList, void (*callback)(const void *)){
+	NODE *pLoc = pList->head->rlink[0];
+
+	while (pLoc != NULL) {
+		callback(pLoc->dataPtr);
+		pLoc = pLoc->rlink[0];
+	}
+}
+
+// traverses data from list (backward)
+void traverseListR( LIST *pList, void (*callback)(const void *)){
+	NODE *pLoc = pList->rear;
+
+	while (pLoc != NULL) {
+		callback(pLoc->dataPtr);
+		pLoc = pLoc->llink;
+	}
+}
@@ -0,0 +1,71 @@
+
+////////////////////////////////////////////////////////////////////////////////
+// skip list
+// adt_dlist.h와 같은 함수(createList, addNode, removeNode, searchNode, traverseList, ...)를 제공
+// 노드마다 임의의 높이(level)를 두어 탐색, 삽입, 삭제가 평균 O(log n)
+// 가장 아래 level은 llink와 함께 이중 연결 리스트이므로 역방향 순회도 가능
+
+#define SKIP_MAX_LEVEL	32	// 2^64개 이상의 노드를 다루는 높이 (p = 1/4)
+
+////////////////////////////////////////////////////////////////////////////////
+// LIST type definition
+typedef struct node
+{
+	void		*dataPtr;
+	struct node	*llink; // 가장 아래 level의 이전 노드 (첫번째 노드는 NULL)
+	int			level; // rlink의 개수
+	struct node	*rlink[]; // level별 다음 노드
+} NODE;
+
+typedef struct
+{
+	int				count;
+	int				level; // 현재 가장 높은 노드의 level
+	NODE			*head; // SKIP_MAX_LEVEL개의 rlink를 가진 header 노드 (데이터 없음)
+	NODE			*rear;
+	unsigned int	seed; // level을 정하는 난수 상태
+	int		(*compare)(const void *, const void *); // used in _search function
+} LIST;
+
+////////////////////////////////////////////////////////////////////////////////
+// function declarations
+
+// Allocates dynamic memory for a list head node and returns its address to caller
+// return	head node pointer
+// 			NULL if overflow
+LIST *createList( int (*compare)(const void *, const void *));
+
+//  이름 리스트에 할당된 메모리를 해제 (head node, data node)
+void destroyList( LIST *pList, void (*callback)(void *));
+
+// Inserts data into list
+// callback은 이미 리스트에 존재하는 데이터를 발견했을 때 호출하는 함수
+//	return	0 if overflow
+//			1 if successful
+//			2 if duplicated key
+int addNode( LIST *pList, void *dataInPtr, void (*callback)(const void *));
+
+// Removes data from list
+//	return	0 not found
+//			1 deleted
+int removeNode( LIST *pList, void *keyPtr, void **dataOutPtr);
+
+// interface to search function
+//	pArgu	key being sought
+//	dataOutPtr	contains found data
+//	return	1 successful
+//			0 not found
+int searchNode( LIST *pList, void *pArgu, void **dataOutPtr);
+
+// returns number of nodes in list
+int countList( LIST *pList);
+
+// returns	1 empty
+//			0 list has data
+int emptyList( LIST *pList);
+
+// traverses data from list (forward)
+void traverseList( LIST *pList, void (*callback)(const void *));
+
+// traverses data from list (backward)
+void traverseListR( LIST *pList, void (*callback)(const void *));
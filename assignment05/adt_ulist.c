@@ -0,0 +1,278 @@
+#include <stdlib.h> // malloc
+#include <string.h> // memmove
+
+#include "adt_ulist.h"
+
+#define ULIST_MIN	(ULIST_NODE_SIZE / 4) // 이보다 적으면 이웃 노드와 합침
+
+// internal function
+// 탐색 대상(정수 키 argKey)과 노드의 index번째 데이터를 비교
+// return	<0, 0, >0 (compare와 같음)
+static inline int _compare(LIST *pList, uint64_t argKey, void *pArgu, NODE *pNode, int index) {
+	if (pList->key != NULL && argKey != pNode->keys[index])
+		return argKey < pNode->keys[index] ? -1 : 1;
+
+	return pList->compare(pArgu, pNode->dataPtr[index]);
+}
+
+// internal search function
+// 대상이 들어 있거나 들어갈 노드와 노드 안의 위치를 찾음
+// 노드의 마지막 데이터만 비교하며 노드를 건너뛰고, 노드 안에서는 이진 탐색
+// for addNode, removeNode, searchNode functions
+// return	1 found (*pIndex는 대상의 위치)
+// 			0 not found (*pIndex는 대상을 삽입할 위치, 빈 리스트이면 *pLoc는 NULL)
+static int _search(LIST *pList, NODE **pLoc, int *pIndex, void *pArgu) {
+	uint64_t argKey = pList->key ? pList->key(pArgu) : 0;
+	NODE *pNode = pList->head;
+	int left, right;
+
+	*pLoc = NULL;
+	*pIndex = 0;
+	if (pNode == NULL) return 0;
+
+	// 마지막 데이터가 대상보다 작으면 다음 노드로 (마지막 노드까지)
+	while (pNode->rlink != NULL && _compare(pList, argKey, pArgu, pNode, pNode->count - 1) > 0)
+		pNode = pNode->rlink;
+
+	*pLoc = pNode;
+
+	left = 0;
+	right = pNode->count - 1;
+	while (left <= right) {
+		int mid = (left + right) / 2;
+		int cmp = _compare(pList, argKey, pArgu, pNode, mid);
+
+		if (cmp == 0) {
+			*pIndex = mid;
+			return 1;
+		}
+		if (cmp < 0) right = mid - 1;
+		else left = mid + 1;
+	}
+	*pIndex = left;
+	return 0;
+}
+
+// internal function
+// 빈 노드를 할당하여 pPre 다음에 연결 (pPre가 NULL이면 빈 리스트의 첫 노드)
+// return	node pointer
+// 			NULL if overflow
+static NODE *_create_node(LIST *pList, NODE *pPre) {
+	NODE *pNew = (NODE *)malloc(sizeof(NODE));
+	if (pNew == NULL) return NULL;
+
+	pNew->count = 0;
+	pNew->llink = pPre;
+
+	if (pPre == NULL) {
+		pNew->rlink = NULL;
+		pList->head = pNew;
+		pList->rear = pNew;
+	} else {
+		pNew->rlink = pPre->rlink;
+		if (pPre->rlink != NULL) pPre->rlink->llink = pNew;
+		else pList->rear = pNew;
+		pPre->rlink = pNew;
+	}
+	return pNew;
+}
+
+// internal function
+// 노드를 연결에서 제거하고 해제
+static void _free_node(LIST *pList, NODE *pNode) {
+	if (pNode->llink != NULL) pNode->llink->rlink = pNode->rlink;
+	else pList->head = pNode->rlink;
+
+	if (pNode->rlink != NULL) pNode->rlink->llink = pNode->llink;
+	else pList->rear = pNode->llink;
+
+	free(pNode);
+}
+
+// internal function
+// src 노드의 from번째부터의 데이터를 dst 노드의 끝으로 옮김
+static void _move(NODE *dst, NODE *src, int from) {
+	int n = src->count - from;
+
+	memcpy(dst->keys + dst->count, src->keys + from, n * sizeof(uint64_t));
+	memcpy(dst->dataPtr + dst->count, src->dataPtr + from, n * sizeof(void *));
+	dst->count += n;
+	src->count = from;
+}
+
+// internal insert function
+// inserts data into node pLoc at index (가득 찬 노드는 둘로 나눔)
+// for addNode function
+// return	1 if successful
+// 			0 if memory overflow
+static int _insert(LIST *pList, NODE *pLoc, int index, void *dataInPtr) {
+	if (pLoc == NULL) { //리스트가 비어있는 경우
+		if ((pLoc = _create_node(pList, NULL)) == NULL) return 0;
+		index = 0;
+	}
+	else if (pLoc->count == ULIST_NODE_SIZE) { //노드가 가득 찬 경우 뒤쪽 절반을 새 노드로
+		NODE *pNew = _create_node(pList, pLoc);
+		if (pNew == NULL) return 0;
+
+		_move(pNew, pLoc, ULIST_NODE_SIZE / 2);
+		if (index > pLoc->count) {
+			index -= pLoc->count;
+			pLoc = pNew;
+		}
+	}
+
+	memmove(pLoc->keys + index + 1, pLoc->keys + index, (pLoc->count - index) * sizeof(uint64_t));
+	memmove(pLoc->dataPtr + index + 1, pLoc->dataPtr + index, (pLoc->count - index) * sizeof(void *));
+	pLoc->keys[index] = pList->key ? pList->key(dataInPtr) : 0;
+	pLoc->dataPtr[index] = dataInPtr;
+	pLoc->count++;
+
+	(pList->count)++;
+	return 1;
+}
+
+// internal delete function
+// deletes data from list and saves the (deleted) data to dataOutPtr
+// 데이터가 ULIST_MIN 미만으로 줄면 이웃 노드와 합침 (합칠 수 없으면 이웃이 3/4 이상 차 있음)
+// for removeNode function
+static void _delete(LIST *pList, NODE *pLoc, int index, void **dataOutPtr) {
+	*dataOutPtr = pLoc->dataPtr[index];
+
+	memmove(pLoc->keys + index, pLoc->keys + index + 1, (pLoc->count - index - 1) * sizeof(uint64_t));
+	memmove(pLoc->dataPtr + index, pLoc->dataPtr + index + 1, (pLoc->count - index - 1) * sizeof(void *));
+	pLoc->count--;
+	(pList->count)--;
+
+	if (pLoc->count == 0) {
+		_free_node(pList, pLoc);
+	}
+	else if (pLoc->count < ULIST_MIN) {
+		if (pLoc->rlink != NULL && pLoc->count + pLoc->rlink->count <= ULIST_NODE_SIZE) {
+			NODE *pNext = pLoc->rlink;
+
+			_move(pLoc, pNext, 0);
+			_free_node(pList, pNext);
+		}
+		else if (pLoc->llink != NULL && pLoc->llink->count + pLoc->count <= ULIST_NODE_SIZE) {
+			_move(pLoc->llink, pLoc, 0);
+			_free_node(pList, pLoc);
+		}
+	}
+}
+
+// Allocates dynamic memory for a list head node and returns its address to caller
+// return	head node pointer
+// 			NULL if overflow
+LIST *createList( int (*compare)(const void *, const void *)){
+	return createListKeyed(compare, NULL);
+}
+
+// createList와 같으나 데이터의 정수 키를 함께 저장
+// key(a) < key(b)이면 compare(a, b) < 0이어야 함 (키가 같을 때만 compare를 호출)
+// return	head node pointer
+// 			NULL if overflow
+LIST *createListKeyed( int (*compare)(const void *, const void *), uint64_t (*key)(const void *)){
+	LIST *mylist = (LIST *)malloc(sizeof(LIST));
+
+	if (mylist == NULL) return NULL;
+
+	mylist->count = 0;
+	mylist->head = NULL;
+	mylist->rear = NULL;
+	mylist->compare = compare;
+	mylist->key = key;
+
+	return mylist;
+}
+
+//  이름 리스트에 할당된 메모리를 해제 (head node, data node)
+void destroyList( LIST *pList, void (*callback)(void *)){
+	NODE *current = pList->head;
+	NODE *next;
+
+	while (current != NULL) {
+		next = current->rlink;
+		for (int i = 0; i < current->count; i++) callback(current->dataPtr[i]);
+		free(current);
+		current = next;
+	}
+	free(pList);
+}
+
+// Inserts data into list
+// callback은 이미 리스트에 존재하는 데이터를 발견했을 때 호출하는 함수
+//	return	0 if overflow
+//			1 if successful
+//			2 if duplicated key
+int addNode( LIST *pList, void *dataInPtr, void (*callback)(const void *)){
+	NODE *pLoc;
+	int index;
+
+	if (_search(pList, &pLoc, &index, dataInPtr)) { //리스트에 이미 존재하는 데이터
+		callback(pLoc->dataPtr[index]);
+		return 2;
+	}
+
+	if (!_insert(pList, pLoc, index, dataInPtr)) return 0; //메모리 오버플로우
+
+	return 1;
+}
+
+// Removes data from list
+//	return	0 not found
+//			1 deleted
+int removeNode( LIST *pList, void *keyPtr, void **dataOutPtr){
+	NODE *pLoc;
+	int index;
+
+	if (!_search(pList, &pLoc, &index, keyPtr)) return 0;
+
+	_delete(pList, pLoc, index, dataOutPtr);
+	return 1;
+}
+
+// interface to search function
+//	pArgu	key being sought
+//	dataOutPtr	contains found data
+//	return	1 successful
+//			0 not found
+int searchNode( LIST *pList, void *pArgu, void **dataOutPtr){
+	NODE *pLoc;
+	int index;
+
+	if (!_search(pList, &pLoc, &index, pArgu)) return 0;
+
+	*dataOutPtr = pLoc->dataPtr[index];
+	return 1;
+}
+
+// returns number of data in list
+int countList( LIST *pList){
+	return pList->count;
+}
+
+// returns	1 empty
+//			0 list has data
+int emptyList( LIST *pList){
+	return pList->count == 0 ? 1 : 0;
+}
+
+// traverses data from list (forward)
+void traverseList( LIST *pList, void (*callback)(const void *)){
+	NODE *pLoc = pList->head;
+
+	while (pLoc != NULL) {
+		for (int i = 0; i < pLoc->count; i++) callback(pLoc->dataPtr[i]);
+		pLoc = pLoc->rlink;
+	}
+}
+
+// traverses data from list (backward)
+void traverseListR( LIST *pList, void (*callback)(const void *)){
+	NODE *pLoc = pList->rear;
+
+	while (pLoc != NULL) {
+		for (int i = pLoc->count - 1; i >= 0; i--) callback(pLoc->dataPtr[i]);
+		pLoc = pLoc->llink;
+	}
+}
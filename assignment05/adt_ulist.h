@@ -0,0 +1,80 @@
+#include <stdint.h> // uint64_t
+
+////////////////////////////////////////////////////////////////////////////////
+// unrolled linked list
+// adt_dlist.h와 같은 함수(createList, addNode, removeNode, searchNode, traverseList, ...)를 제공
+// 노드 하나에 최대 ULIST_NODE_SIZE개의 데이터를 정렬된 배열로 저장하여 포인터를 따라가는 횟수를 줄임
+// createListKeyed로 만들면 데이터마다 정수 키(예: 단어의 앞 8바이트)를 노드 안에 함께 저장하여,
+// 대부분의 비교가 데이터를 읽지 않고 노드 안의 정수 비교로 끝남
+// 노드가 가득 차면 둘로 나누고, 삭제로 ULIST_NODE_SIZE / 4 미만이 되면 이웃 노드와 합침
+
+#define ULIST_NODE_SIZE	16
+
+////////////////////////////////////////////////////////////////////////////////
+// LIST type definition
+typedef struct node
+{
+	int			count; // 노드에 저장된 데이터 수 (1 ~ ULIST_NODE_SIZE)
+	uint64_t	keys[ULIST_NODE_SIZE]; // 데이터의 정수 키 (createListKeyed)
+	void		*dataPtr[ULIST_NODE_SIZE]; // 정렬된 데이터
+	struct node	*llink;
+	struct node	*rlink;
+} NODE;
+
+typedef struct
+{
+	int		count; // 데이터 수
+	NODE	*head;
+	NODE	*rear;
+	int		(*compare)(const void *, const void *); // used in _search function
+	uint64_t	(*key)(const void *); // 정수 키 (NULL이면 compare만 사용)
+} LIST;
+
+////////////////////////////////////////////////////////////////////////////////
+// function declarations
+
+// Allocates dynamic memory for a list head node and returns its address to caller
+// return	head node pointer
+// 			NULL if overflow
+LIST *createList( int (*compare)(const void *, const void *));
+
+// createList와 같으나 데이터의 정수 키를 함께 저장
+// key(a) < key(b)이면 compare(a, b) < 0이어야 함 (키가 같을 때만 compare를 호출)
+// return	head node pointer
+// 			NULL if overflow
+LIST *createListKeyed( int (*compare)(const void *, const void *), uint64_t (*key)(const void *));
+
+//  이름 리스트에 할당된 메모리를 해제 (head node, data node)
+void destroyList( LIST *pList, void (*callback)(void *));
+
+// Inserts data into list
+// callback은 이미 리스트에 존재하는 데이터를 발견했을 때 호출하는 함수
+//	return	0 if overflow
+//			1 if successful
+//			2 if duplicated key
+int addNode( LIST *pList, void *dataInPtr, void (*callback)(const void *));
+
+// Removes data from list
+//	return	0 not found
+//			1 deleted
+int removeNode( LIST *pList, void *keyPtr, void **dataOutPtr);
+
+// interface to search function
+//	pArgu	key being sought
+//	dataOutPtr	contains found data
+//	return	1 successful
+//			0 not found
+int searchNode( LIST *pList, void *pArgu, void **dataOutPtr);
+
+// returns number of data in list
+int countList( LIST *pList);
+
+// returns	1 empty
+//			0 list has data
+int emptyList( LIST *pList);
+
+// traverses data from list (forward)
+void traverseList( LIST *pList, void (*callback)(const void *));
+
+// traverses data from list (backward)
+void traverseListR( LIST *pList, void (*callback)(const void *));
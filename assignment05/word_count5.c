@@ -1,9 +1,22 @@
 #include <stdio.h>
 #include <stdlib.h> // malloc
-#include <string.h> // strdup, strcmp
+#include <string.h> // strlen, strcmp
 #include <ctype.h> // toupper
 
+#if defined(USE_SKIPLIST)
+#include "adt_skiplist.h" // make SKIPLIST=1
+#elif defined(USE_UNROLLED)
+#include "adt_ulist.h" // make UNROLLED=1
+#include "word_key.h"
+#else
 #include "adt_dlist.h"
+#endif
+#include "tokenizer.h"
+#include "str_arena.h"
+#include "outbuf.h"
+#include "wc_stats.h"
+#include "word_dict.h"
+#include "word_batch.h"
 
 #define QUIT			1
 #define FORWARD_PRINT	2
@@ -19,6 +32,10 @@ typedef struct {
 	int		freq;		// 빈도
 } tWord;
 
+// 단어 문자열 저장소
+// 모든 단어 구조체의 word는 여기에 인터닝되며, 사전을 해제할 때 한 번에 해제
+static STRARENA *word_arena;
+
 ////////////////////////////////////////////////////////////////////////////////
 // 단어 구조체를 위한 메모리를 할당하고 word, freq 초기화
 // return	할당된 단어 구조체에 대한 pointer
@@ -27,19 +44,19 @@ tWord *createWord( char *word){
 	tWord *pWord=(tWord *)malloc(sizeof(tWord));
 		
 	if(pWord!=NULL){
-		pWord->word=strdup(word);
+		pWord->word=(char *)strarena_Intern(word_arena, word, strlen(word));
 		pWord->freq=1;	
 	}
 	return pWord;
 }
 
 //  단어 구조체에 할당된 메모리를 해제
+// 단어 문자열은 word_arena가 일괄 해제
 // for destroyList function
 void destroyWord( void *pNode){
 	tWord *wordNode= (tWord *)pNode;
 	
 	if(wordNode!= NULL){
-		free(wordNode->word);
 		free(wordNode);
 	}
 }
@@ -77,14 +94,31 @@ int compare_by_word( const void *n1, const void *n2)
 	tWord *p1 = (tWord *)n1;
 	tWord *p2 = (tWord *)n2;
 	
+	STATS_CMP();
 	return strcmp( p1->word, p2->word);
 }
 
+#ifdef USE_UNROLLED
+// 단어의 앞 8바이트 키
+// for createListKeyed function (키가 다르면 compare_by_word를 호출하지 않음)
+uint64_t word_prefix( const void *n)
+{
+	const char *word = ((tWord *)n)->word;
+	
+	return wkey_Make( word, strlen( word));
+}
+#endif
+
 // prints contents of word structure
 // for traverseList and traverseListR functions
 void print_word(const void *dataPtr)
 {
-	printf( "%s\t%d\n", ((tWord *)dataPtr)->word, ((tWord *)dataPtr)->freq);
+	OUTBUF *out = out_Stdout();
+	
+	out_Str( out, ((tWord *)dataPtr)->word);
+	out_Char( out, '\t');
+	out_Int( out, ((tWord *)dataPtr)->freq);
+	out_Char( out, '\n');
 }
 
 void increase_freq(const void *dataPtr)
@@ -99,6 +133,227 @@ void input_word(char *word)
 	fscanf( stdin, "%s", word);
 }
 
+#ifdef WC_STATS
+////////////////////////////////////////////////////////////////////////////////
+// 벤치마크: 입력의 모든 단어를 사전(단어순 리스트)에서 다시 찾음
+// return	찾은 단어의 수 (입력의 단어 수)
+static long stats_lookup( const char *filename, LIST *list)
+{
+	TOKENIZER *tok = tok_Open( filename, TOK_CSTR);
+	tToken token;
+	tWord key;
+	void *ptr;
+	long n = 0;
+	
+	if (tok == NULL) return 0;
+	
+	STATS_BEGIN();
+	while (tok_Next( tok, &token))
+	{
+		key.word = (char *)token.ptr;
+		STATS_SINK( searchNode( list, &key, &ptr));
+		n++;
+	}
+	STATS_END( STATS_LOOKUP, n);
+	
+	tok_Close( tok);
+	return n;
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// 이진 사전 파일 (--save, --load)
+
+// 사전을 저장할 writer (save_word에서 사용)
+static WDICT_WRITER *dict_writer;
+
+// 단어 구조체를 dict_writer에 추가
+// for traverseList function (단어순으로 호출됨)
+static void save_word( const void *dataPtr)
+{
+	const tWord *w = (const tWord *)dataPtr;
+	
+	wdict_Add( dict_writer, w->word, strlen( w->word), w->freq);
+}
+
+// 사전을 이진 사전 파일로 저장
+// return	1 if successful
+//			0 if the file cannot be written
+static int save_dict( const char *filename, LIST *list)
+{
+	int ok;
+	
+	if ((dict_writer = wdict_Create()) == NULL) return 0;
+	
+	traverseList( list, save_word);
+	ok = wdict_Save( dict_writer, filename);
+	
+	wdict_Destroy( dict_writer);
+	dict_writer = NULL;
+	
+	return ok;
+}
+
+// prints index-th word of the loaded dictionary (print_word와 같은 형식)
+static void print_dict_word( const WDICT *dict, int index)
+{
+	OUTBUF *out = out_Stdout();
+	
+	out_Write( out, wdict_Word( dict, index), wdict_Len( dict, index));
+	out_Char( out, '\t');
+	out_Int( out, wdict_Freq( dict, index));
+	out_Char( out, '\n');
+}
+
+// 이진 사전 파일을 읽기 전용으로 매핑하여 질의에 답함 (단어 파일을 읽거나 사전을 만들지 않음)
+// 매핑된 사전은 수정할 수 없으므로 삭제 등은 지원하지 않음
+static int run_loaded( const char *filename)
+{
+	WDICT *dict = wdict_Open( filename);
+	char word[100];
+	int index;
+	
+	if (!dict)
+	{
+		fprintf( stderr, "Error: cannot load dictionary [%s]\n", filename);
+		return 2;
+	}
+	
+	fprintf( stderr, "Select Q)uit, P)rint, B)ackward print, S)earch, D)elete, C)ount: ");
+	
+	while (1)
+	{
+		int action = get_action();
+		
+		switch( action)
+		{
+			case QUIT:
+				wdict_Close( dict);
+				return 0;
+			
+			case FORWARD_PRINT:
+				for (int i = 0; i < wdict_Count( dict); i++) print_dict_word( dict, i);
+				break;
+			
+			case BACKWARD_PRINT:
+				for (int i = wdict_Count( dict) - 1; i >= 0; i--) print_dict_word( dict, i);
+				break;
+			
+			case SEARCH:
+				input_word(word);
+				
+				if ((index = wdict_Search( dict, word)) >= 0) print_dict_word( dict, index);
+				else fprintf( stdout, "%s not found\n", word);
+				break;
+			
+			case DELETE:
+				input_word(word);
+				fprintf( stdout, "not available for a loaded dictionary\n");
+				break;
+			
+			case COUNT:
+				fprintf( stdout, "%d\n", wdict_Count( dict));
+				break;
+		}
+		
+		// printf 출력과 print_dict_word(out_Stdout) 출력의 순서 유지
+		fflush( stdout);
+		out_Flush( out_Stdout());
+		
+		if (action) fprintf( stderr, "Select Q)uit, P)rint, B)ackward print, S)earch, D)elete, C)ount: ");
+	}
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// 질의 파일 (--batch, --batch-each)
+
+// merge-join할 최소 run 길이 (순회 한 번의 비용 count와 질의마다의 탐색 비용을 비교)
+#if defined(USE_SKIPLIST)
+#define BATCH_MIN_RUN( count)	((count) / 16 + 2)	// 탐색이 O(log n)
+#elif defined(USE_UNROLLED)
+#define BATCH_MIN_RUN( count)	(2 * ULIST_NODE_SIZE)	// 탐색이 노드 수(count / ULIST_NODE_SIZE)에 비례
+#else
+#define BATCH_MIN_RUN( count)	2	// 질의 하나가 평균 리스트의 절반을 지남
+#endif
+
+// merge-join 중인 질의 파일 (match_word에서 사용)
+static WBATCH *batch;
+
+// 사전의 단어를 batch의 질의와 맞춤
+// for traverseList function (단어순으로 호출됨)
+static void match_word( const void *dataPtr)
+{
+	wbatch_Match( batch, ((tWord *)dataPtr)->word, (void *)dataPtr);
+}
+
+// 질의 결과를 출력 (메뉴의 S)earch, D)elete와 같은 형식)
+static void print_result( const tQuery *q)
+{
+	OUTBUF *out = out_Stdout();
+	const tWord *w = (const tWord *)q->result;
+	
+	if (w == NULL)
+	{
+		out_Str( out, q->word);
+		out_Str( out, " not found\n");
+	}
+	else if (q->op == WBATCH_SEARCH) print_word( w);
+	else
+	{
+		out_Char( out, '(');
+		out_Str( out, w->word);
+		out_Str( out, ", ");
+		out_Int( out, w->freq);
+		out_Str( out, ") deleted\n");
+	}
+}
+
+// 질의 파일의 S, D를 차례로 처리하고 결과를 질의 순서대로 출력
+// merge이면 연속된 S를 단어순으로 정렬하여 리스트 순회 한 번으로 답하고 (BATCH_MIN_RUN 이상일 때), 나머지는 질의마다 searchNode
+// return	0 if successful
+//			2 if the query file cannot be read
+static int run_batch( const char *filename, LIST *list, int merge)
+{
+	tWord key;
+	void *ptr;
+	int end;
+	
+	if ((batch = wbatch_Load( filename)) == NULL) return 2;
+	
+	STATS_BEGIN();
+	for (int i = 0; i < batch->count; i = end)
+	{
+		end = merge ? wbatch_RunEnd( batch, i) : i;
+		if (end - i >= BATCH_MIN_RUN( countList( list)) && wbatch_Begin( batch, i, end))
+		{
+			traverseList( list, match_word);
+			for (int j = i; j < end; j++) print_result( &batch->queries[j]);
+			continue;
+		}
+		
+		// D 질의, 또는 merge-join하기에 짧은 run은 질의마다 처리
+		if (end == i) end = i + 1;
+		for (int j = i; j < end; j++)
+		{
+			tQuery *q = &batch->queries[j];
+			
+			key.word = q->word;
+			if (q->op == WBATCH_SEARCH) q->result = searchNode( list, &key, &ptr) ? ptr : NULL;
+			else q->result = removeNode( list, &key, &ptr) ? ptr : NULL;
+			
+			print_result( q);
+			if (q->op == WBATCH_DELETE && q->result) destroyWord( q->result);
+		}
+	}
+	STATS_END( STATS_LOOKUP, batch->count);
+	
+	out_Flush( out_Stdout());
+	wbatch_Close( batch);
+	batch = NULL;
+	return 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 int main( int argc, char **argv)
 {
@@ -106,32 +361,67 @@ int main( int argc, char **argv)
 	
 	char word[100];
 	tWord *pWord;
+	tWord key; // S)earch, D)elete의 탐색 키 (word는 입력 버퍼, 인터닝하지 않음)
 	int ret;
-	FILE *fp;
+	TOKENIZER *tok;
+	tToken token;
+	const char *save_file = NULL;
+	const char *batch_file = NULL;
+	int batch_merge = 1;
+	
+	// --load DICT : 저장된 이진 사전으로 질의에 답함
+	if (argc == 3 && strcmp( argv[1], "--load") == 0) return run_loaded( argv[2]);
+	
+	// --save DICT FILE : 사전을 만든 뒤 이진 사전 파일로 저장
+	if (argc == 4 && strcmp( argv[1], "--save") == 0)
+	{
+		save_file = argv[2];
+		argc -= 2;
+		argv += 2;
+	}
+	
+	// --batch QUERIES FILE : 사전을 만든 뒤 메뉴 대신 질의 파일을 처리
+	// --batch-each QUERIES FILE : 같은 처리를 질의마다 탐색하여 수행 (비교용)
+	else if (argc == 4 && (strcmp( argv[1], "--batch") == 0 || strcmp( argv[1], "--batch-each") == 0))
+	{
+		batch_file = argv[2];
+		batch_merge = (strcmp( argv[1], "--batch") == 0);
+		argc -= 2;
+		argv += 2;
+	}
 	
 	if (argc != 2) {
-		fprintf( stderr, "usage: %s FILE\n", argv[0]);
+		fprintf( stderr, "usage: %s [--save DICT | --batch QUERIES | --batch-each QUERIES] FILE\n", argv[0]);
+		fprintf( stderr, "       %s --load DICT\n", argv[0]);
 		return 1;
 	}
 	
-	fp = fopen( argv[1], "rt");
-	if (!fp)
+	tok = tok_Open( argv[1], TOK_CSTR);
+	if (!tok)
 	{
 		fprintf( stderr, "Error: cannot open file [%s]\n", argv[1]);
 		return 2;
 	}
 	
 	// creates an empty list
+#if defined(USE_UNROLLED)
+	list = createListKeyed( compare_by_word, word_prefix);
+#elif defined(USE_SKIPLIST)
 	list = createList( compare_by_word);
-	if (!list)
+#else
+	list = createListPooled( compare_by_word); // 노드를 pool에서 할당
+#endif
+	word_arena = strarena_Create();
+	if (!list || !word_arena)
 	{
 		printf( "Cannot create list\n");
 		return 100;
 	}
 	
-	while(fscanf( fp, "%s", word) != EOF)
+	STATS_BEGIN();
+	while(tok_Next( tok, &token))
 	{
-		pWord = createWord( word);
+		pWord = createWord( (char *)token.ptr);
 		
 		// 이미 저장된 단어는 빈도 증가
 		ret = addNode( list, pWord, increase_freq);
@@ -141,8 +431,30 @@ int main( int argc, char **argv)
 			destroyWord( pWord);
 		}
 	}
+	STATS_END( STATS_BUILD, 0);
 	
-	fclose( fp);
+	tok_Close( tok);
+
+#ifdef WC_STATS
+	STATS_OPS( STATS_BUILD, stats_lookup( argv[1], list));
+#endif
+	
+	if (save_file && !save_dict( save_file, list))
+	{
+		fprintf( stderr, "Error: cannot save dictionary [%s]\n", save_file);
+		destroyList( list, destroyWord);
+		strarena_Destroy( word_arena);
+		return 3;
+	}
+	
+	if (batch_file)
+	{
+		ret = run_batch( batch_file, list, batch_merge);
+		STATS_REPORT( countList( list));
+		destroyList( list, destroyWord);
+		strarena_Destroy( word_arena);
+		return ret;
+	}
 	
 	fprintf( stderr, "Select Q)uit, P)rint, B)ackward print, S)earch, D)elete, C)ount: ");
 	
@@ -154,11 +466,16 @@ int main( int argc, char **argv)
 		switch( action)
 		{
 			case QUIT:
+				STATS_REPORT( countList( list));
 				destroyList( list, destroyWord);
+				strarena_Destroy( word_arena);
 				return 0;
 			
 			case FORWARD_PRINT:
+				STATS_BEGIN();
 				traverseList( list, print_word);
+				out_Flush( out_Stdout());
+				STATS_END( STATS_DUMP, countList( list));
 				break;
 			
 			case BACKWARD_PRINT:
@@ -168,27 +485,23 @@ int main( int argc, char **argv)
 			case SEARCH:
 				input_word(word);
 				
-				pWord = createWord( word);
+				key.word = word;
 
-				if (searchNode( list, pWord, &ptr)) print_word( ptr);
+				if (searchNode( list, &key, &ptr)) print_word( ptr);
 				else fprintf( stdout, "%s not found\n", word);
-				
-				destroyWord( pWord);
 				break;
 				
 			case DELETE:
 				input_word(word);
 				
-				pWord = createWord( word);
+				key.word = word;
 
-				if (removeNode( list, pWord, &ptr))
+				if (removeNode( list, &key, &ptr))
 				{
 					fprintf( stdout, "(%s, %d) deleted\n", ((tWord *)ptr)->word, ((tWord *)ptr)->freq);
 					destroyWord( ptr);
 				}
 				else fprintf( stdout, "%s not found\n", word);
-				
-				destroyWord( (tWord *)pWord);
 				break;
 			
 			case COUNT:
@@ -196,6 +509,10 @@ int main( int argc, char **argv)
 				break;
 		}
 		
+		// printf 출력과 print_word(out_Stdout) 출력의 순서 유지
+		fflush( stdout);
+		out_Flush( out_Stdout());
+		
 		if (action) fprintf( stderr, "Select Q)uit, P)rint, B)ackward print, S)earch, D)elete, C)ount: ");
 	}
 	return 0;
@@ -1,3 +1,8 @@
+////////////////////////////////////////////////////////////////////////////////
+// binary search tree
+// BST_Insert, BST_Delete, BST_Search는 bst.c, 나머지 함수는 bst_common.c에 있음
+// make SPLAY=1이면 bst.c 대신 splay.c(top-down splay tree)의 BST_Insert, BST_Delete, BST_Search를 링크
+
 ////////////////////////////////////////////////////////////////////////////////
 // TREE type definition
 typedef struct node
@@ -35,6 +40,13 @@ void BST_Destroy( TREE *pTree, void (*callback)(void *));
 */
 int BST_Insert( TREE *pTree, void *dataInPtr, void (*callback)(void *));
 
+/* Builds a balanced tree from count data sorted by compare (중복 없는 오름차순)
+	빈 트리에 하나씩 삽입하지 않고 가운데 데이터를 루트로 하여 O(n)에 만듦 (compare는 호출하지 않음)
+	return	1 success
+			0 overflow or the tree is not empty (트리는 빈 상태로 남음)
+*/
+int BST_BuildSorted( TREE *pTree, void **dataInPtr, int count);
+
 /* Deletes a node with keyPtr from the tree
 	return	address of data of the node containing the key
 			NULL not found
@@ -42,12 +54,15 @@ int BST_Insert( TREE *pTree, void *dataInPtr, void (*callback)(void *));
 void *BST_Delete( TREE *pTree, void *keyPtr);
 
 /* Retrieve tree for the node containing the requested key (keyPtr)
+	splay.c에서는 찾은 노드(없으면 마지막으로 비교한 노드)를 루트로 올리므로 트리의 모양이 바뀜
 	return	address of data of the node containing the key
 			NULL not found
 */
 void *BST_Search( TREE *pTree, void *keyPtr);
 
 /* prints tree using inorder traversal
+	재귀나 스택 없이 순회하며 순회 중에 잠시 연결을 바꾸므로, callback에서 트리를 탐색하거나 변경하면 안 됨
+	(BST_TraverseR, printTree도 같음)
 */
 void BST_Traverse( TREE *pTree, void (*callback)(const void *));
 
@@ -56,6 +71,7 @@ void BST_Traverse( TREE *pTree, void (*callback)(const void *));
 void BST_TraverseR( TREE *pTree, void (*callback)(const void *));
 
 /* Print tree using right-to-left inorder traversal with level
+	레벨만큼의 탭은 out_Stdout()으로 출력하므로 callback도 같은 writer를 사용해야 함
 */
 void printTree( TREE *pTree, void (*callback)(const void *));
 
@@ -63,3 +79,9 @@ void printTree( TREE *pTree, void (*callback)(const void *));
 */
 int BST_Count( TREE *pTree);
 
+/* Allocates a node for dataInPtr (left, right는 NULL)
+	BST_Insert(bst.c, splay.c)와 BST_BuildSorted에서 사용
+	return	node pointer
+			NULL if overflow
+*/
+NODE *BST_MakeNode( void *dataInPtr);
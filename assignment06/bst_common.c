@@ -0,0 +1,256 @@
+#include <stdlib.h> // malloc
+#include <stdio.h>
+
+#include "bst.h"
+#include "outbuf.h"
+
+// 트리의 모양만 다른 bst.c와 splay.c가 같이 쓰는 함수
+// 탐색, 삽입, 삭제(BST_Search, BST_Insert, BST_Delete)는 bst.c 또는 splay.c(make SPLAY=1)에 있음
+
+// internal functions (not mandatory)
+// 한쪽으로 치우친 긴 사슬도 다룰 수 있도록, 모든 연산을 재귀 없이 반복문으로 처리 (깊이 제한 없음)
+
+// used in BST_BuildSorted
+// 구간 [lo, hi)의 가운데 데이터를 노드로 만들어 *link에 연결한 뒤, 왼쪽과 오른쪽 구간을 같은 방법으로 처리
+// 남은 구간은 트리 높이만큼만 쌓이므로 (높이는 최대 32) 고정 크기 스택을 사용
+// return	1 success
+//			0 overflow (그때까지 만든 노드는 *link 아래에 연결되어 있음)
+static int _buildSorted( NODE **link, void **dataInPtr, int count){
+	struct {
+		int		lo, hi;
+		NODE	**link;
+	} stack[64];
+	int top=0;
+	
+	if(count>0){
+		stack[0].lo=0;
+		stack[0].hi=count;
+		stack[0].link=link;
+		top=1;
+	}
+	while(top>0){
+		top--;
+		int lo=stack[top].lo, hi=stack[top].hi;
+		int mid=lo+(hi-lo)/2; // 왼쪽 구간이 오른쪽과 같거나 1 큼
+		NODE *node=BST_MakeNode(dataInPtr[mid]);
+		
+		if(!node) return 0;
+		*stack[top].link=node;
+		
+		if(mid+1<hi){
+			stack[top].lo=mid+1;
+			stack[top].hi=hi;
+			stack[top].link=&node->right;
+			top++;
+		}
+		if(lo<mid){
+			stack[top].lo=lo;
+			stack[top].hi=mid;
+			stack[top].link=&node->left;
+			top++;
+		}
+	}
+	return 1;
+}
+
+// used in BST_Destroy
+// 왼쪽 자식이 있으면 오른쪽으로 회전하여 끌어올리고, 없으면 루트를 해제한 뒤 오른쪽으로 진행 (스택 없이 O(n))
+static void _destroy( NODE *root, void (*callback)(void *)){
+	while(root){
+		if(root->left){
+			NODE *left=root->left;
+			root->left=left->right;
+			left->right=root;
+			root=left;
+		}
+		else{
+			NODE *right=root->right;
+			if(callback){
+				callback(root->dataPtr);
+			}
+			free(root);
+			root=right;
+		}
+	}
+}
+		
+
+// used in BST_Traverse
+// Morris 순회: 왼쪽 서브트리의 가장 오른쪽 노드(선행 노드)의 right에 잠시 현재 노드를 연결하여
+// 스택 없이 되돌아옴 (순회가 끝나면 트리는 원래대로 복구됨)
+static void _traverse( NODE *root, void (*callback)(const void *)){
+	while(root){
+		if(!root->left){
+			callback(root->dataPtr);
+			root=root->right;
+		}
+		else{
+			NODE *pred=root->left;
+			while(pred->right && pred->right!=root){
+				pred=pred->right;
+			}
+			if(!pred->right){ //처음 방문: 선행 노드에 연결하고 왼쪽으로
+				pred->right=root;
+				root=root->left;
+			}
+			else{ //왼쪽 서브트리를 마치고 돌아옴: 연결을 되돌리고 방문
+				pred->right=NULL;
+				callback(root->dataPtr);
+				root=root->right;
+			}
+		}
+	}
+}
+
+// used in BST_TraverseR
+// _traverse의 좌우 대칭 (후속 노드의 left에 잠시 연결)
+static void _traverseR( NODE *root, void (*callback)(const void *)){
+	while(root){
+		if(!root->right){
+			callback(root->dataPtr);
+			root=root->left;
+		}
+		else{
+			NODE *succ=root->right;
+			while(succ->left && succ->left!=root){
+				succ=succ->left;
+			}
+			if(!succ->left){
+				succ->left=root;
+				root=root->right;
+			}
+			else{
+				succ->left=NULL;
+				callback(root->dataPtr);
+				root=root->left;
+			}
+		}
+	}
+}
+
+// used in printTree
+// _traverseR과 같은 순서로 방문하며 레벨을 계산
+// 연결을 따라 돌아올 때는 내려갔던 거리(step)만큼 레벨을 되돌림
+static void _inorder_print( NODE *root, int level, void (*callback)(const void *)){
+	while(root){
+		if(!root->right){
+			for(int i=0; i<level; i++){ //레벨만큼 탭 출력
+				out_Char(out_Stdout(), '\t');
+			}
+			callback(root->dataPtr);
+			root=root->left;
+			level++;
+		}
+		else{
+			NODE *succ=root->right;
+			int step=1;
+			while(succ->left && succ->left!=root){
+				succ=succ->left;
+				step++;
+			}
+			if(!succ->left){
+				succ->left=root;
+				root=root->right;
+				level++;
+			}
+			else{ //succ(레벨 level+step)에서 연결을 따라 왔으므로 level은 level+step+1
+				succ->left=NULL;
+				level-=step+1;
+				for(int i=0; i<level; i++){ //레벨만큼 탭 출력
+					out_Char(out_Stdout(), '\t');
+				}
+				callback(root->dataPtr);
+				root=root->left;
+				level++;
+			}
+		}
+	}
+}
+	
+/* Allocates a node for dataInPtr (left, right는 NULL)
+	BST_Insert(bst.c, splay.c)와 BST_BuildSorted에서 사용
+	return	node pointer
+			NULL if overflow
+*/
+NODE *BST_MakeNode( void *dataInPtr){
+	NODE *node=(NODE *)malloc(sizeof(NODE));
+	if(node){
+		node->left=NULL;
+		node->right=NULL;
+		node->dataPtr=dataInPtr;
+	}
+	return node;
+}
+
+/* Allocates dynamic memory for a tree head node and returns its address to caller
+	return	head node pointer
+			NULL if overflow
+*/
+TREE *BST_Create( int (*compare)(const void *, const void *)){
+	TREE *tree=(TREE *)malloc(sizeof(TREE));
+	
+	if(tree!=NULL){
+	tree->count=0;
+	tree->root=NULL;
+	tree->compare=compare;
+	}
+	return tree;
+}
+
+/* Deletes all data in tree and recycles memory
+*/
+void BST_Destroy( TREE *pTree, void (*callback)(void *)){
+	if(pTree){
+		_destroy(pTree->root, callback);
+		free(pTree);
+	}
+}
+
+/* Builds a balanced tree from count data sorted by compare (중복 없는 오름차순)
+	빈 트리에 하나씩 삽입하지 않고 가운데 데이터를 루트로 하여 O(n)에 만듦 (compare는 호출하지 않음)
+	return	1 success
+			0 overflow or the tree is not empty (트리는 빈 상태로 남음)
+*/
+int BST_BuildSorted( TREE *pTree, void **dataInPtr, int count){
+	if(!pTree || pTree->root) return 0;
+	
+	if(!_buildSorted(&pTree->root, dataInPtr, count)){
+		_destroy(pTree->root, NULL);
+		pTree->root=NULL;
+		return 0;
+	}
+	pTree->count=count;
+	return 1;
+}
+
+/* prints tree using inorder traversal
+*/
+void BST_Traverse( TREE *pTree, void (*callback)(const void *)){
+	if(pTree->root){
+		_traverse(pTree->root, callback); //print_word
+	}
+}
+
+/* prints tree using right-to-left inorder traversal
+*/
+void BST_TraverseR( TREE *pTree, void (*callback)(const void *)){
+	if(pTree->root){
+		_traverseR(pTree->root, callback);
+	}
+}
+
+/* Print tree using right-to-left inorder traversal with level
+*/
+void printTree( TREE *pTree, void (*callback)(const void *)){
+	if(pTree->root){
+		_inorder_print(pTree->root, 0, callback); //print_word_only(줄 바꿈 문자 포함)
+	}
+}
+
+/* returns number of nodes in tree
+*/
+int BST_Count( TREE *pTree){
+	return pTree->count;
+}
+
+
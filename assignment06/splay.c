@@ -0,0 +1,162 @@
+#include <stdlib.h> // malloc
+
+#include "bst.h"
+
+// splay tree (make SPLAY=1이면 bst.c 대신 링크)
+// bst.c와 같은 BST_Insert, BST_Delete, BST_Search를 제공하며, 나머지 BST_* 함수는 bst_common.c를 같이 사용
+// 삽입, 삭제, 탐색할 때마다 top-down splay로 해당 노드를 루트로 올리므로, 자주 찾는 단어는 루트 가까이에 모임
+// 한 번의 연산은 O(n)일 수 있지만 연속된 연산의 비용은 연산당 분할 상환 O(log n)
+
+// internal functions (not mandatory)
+// splay tree는 (정렬된 순서로 삽입하는 등) 한쪽으로 치우친 긴 사슬이 될 수 있으므로, 모든 연산을 재귀 없이 반복문으로 처리 (깊이 제한 없음)
+
+// used in BST_Insert, BST_Delete, BST_Search
+// top-down splay: keyPtr를 찾아 내려가면서 지나온 노드를 keyPtr보다 작은 노드의 왼쪽 트리와 큰 노드의 오른쪽 트리로 떼어 내고,
+// 마지막 노드를 루트로 하여 두 트리를 다시 붙임 (같은 방향으로 두 번 내려가면(zig-zig) 먼저 회전)
+// keyPtr가 없으면 마지막으로 비교한 노드(keyPtr의 선행 또는 후속 노드)가 루트가 됨
+// 노드마다 한 번만 비교하며, 새 루트와의 비교 결과는 *cmpOut에
+// return	new root
+static NODE *_splay( NODE *root, void *keyPtr, int (*compare)(const void *, const void *), int *cmpOut){
+	NODE header; // header.right: 왼쪽 트리, header.left: 오른쪽 트리
+	NODE *l=&header, *r=&header; // 왼쪽 트리의 가장 큰 노드, 오른쪽 트리의 가장 작은 노드
+	int cmp=compare(keyPtr, root->dataPtr);
+	
+	header.left=header.right=NULL;
+	while(cmp){
+		if(cmp<0){
+			NODE *child=root->left;
+			if(!child) break;
+			
+			int c=compare(keyPtr, child->dataPtr);
+			if(c<0){ //zig-zig: 오른쪽으로 회전한 뒤 떼어 냄
+				root->left=child->right;
+				child->right=root;
+				root=child;
+				if(!root->left){
+					cmp=c;
+					break;
+				}
+				r->left=root; //오른쪽 트리에 연결
+				r=root;
+				root=root->left;
+				cmp=compare(keyPtr, root->dataPtr);
+			}
+			else{ //zig
+				r->left=root;
+				r=root;
+				root=child;
+				cmp=c;
+			}
+		}
+		else{
+			NODE *child=root->right;
+			if(!child) break;
+			
+			int c=compare(keyPtr, child->dataPtr);
+			if(c>0){ //zig-zig: 왼쪽으로 회전한 뒤 떼어 냄
+				root->right=child->left;
+				child->left=root;
+				root=child;
+				if(!root->right){
+					cmp=c;
+					break;
+				}
+				l->right=root; //왼쪽 트리에 연결
+				l=root;
+				root=root->right;
+				cmp=compare(keyPtr, root->dataPtr);
+			}
+			else{ //zig
+				l->right=root;
+				l=root;
+				root=child;
+				cmp=c;
+			}
+		}
+	}
+	
+	//다시 붙임: 루트의 서브트리는 양쪽 트리의 끝에, 양쪽 트리는 루트의 서브트리로
+	l->right=root->left;
+	r->left=root->right;
+	root->left=header.right;
+	root->right=header.left;
+	
+	*cmpOut=cmp;
+	return root;
+}
+
+/* Inserts new data into the tree
+	callback은 이미 트리에 존재하는 데이터를 발견했을 때 호출하는 함수
+	return	0 overflow
+			1 success
+			2 if duplicated key
+*/
+int BST_Insert( TREE *pTree, void *dataInPtr, void (*callback)(void *)){
+	NODE *newPtr=BST_MakeNode(dataInPtr);
+	
+	if(!newPtr) return 0;
+	if(pTree->root){
+		int cmp;
+		NODE *root=_splay(pTree->root, dataInPtr, pTree->compare, &cmp);
+		
+		if(cmp==0){ //중복된 경우 (루트가 된 노드의 데이터를 증가시킴)
+			pTree->root=root;
+			callback(root->dataPtr);
+			free(newPtr);
+			return 2;
+		}
+		if(cmp<0){ //루트보다 작음: 루트와 그 오른쪽 서브트리가 새 노드의 오른쪽으로
+			newPtr->left=root->left;
+			newPtr->right=root;
+			root->left=NULL;
+		}
+		else{
+			newPtr->right=root->right;
+			newPtr->left=root;
+			root->right=NULL;
+		}
+	}
+	pTree->root=newPtr;
+	(pTree->count)++;
+	return 1;
+}
+	
+
+/* Deletes a node with keyPtr from the tree
+	return	address of data of the node containing the key
+			NULL not found
+*/
+void *BST_Delete( TREE *pTree, void *keyPtr){
+	void *dataOut;
+	NODE *root;
+	int cmp;
+	
+	if(!pTree->root) return NULL;
+	root=pTree->root=_splay(pTree->root, keyPtr, pTree->compare, &cmp);
+	if(cmp) return NULL;
+	
+	if(!root->left){
+		pTree->root=root->right;
+	}
+	else{ //왼쪽 서브트리의 노드는 모두 keyPtr보다 작으므로 splay하면 가장 큰 노드가 (오른쪽 자식 없이) 루트가 됨
+		pTree->root=_splay(root->left, keyPtr, pTree->compare, &cmp);
+		pTree->root->right=root->right;
+	}
+	dataOut=root->dataPtr;
+	free(root);
+	pTree->count--;
+	return dataOut;
+}
+
+/* Retrieve tree for the node containing the requested key (keyPtr)
+	찾은 노드(없으면 마지막으로 비교한 노드)를 루트로 올리므로 트리의 모양이 바뀜
+	return	address of data of the node containing the key
+			NULL not found
+*/
+void *BST_Search( TREE *pTree, void *keyPtr){
+	int cmp;
+	
+	if(!pTree->root) return NULL;
+	pTree->root=_splay(pTree->root, keyPtr, pTree->compare, &cmp);
+	return cmp ? NULL : pTree->root->dataPtr;
+}
@@ -1,9 +1,17 @@
 #include <stdio.h>
 #include <stdlib.h> // malloc
-#include <string.h> // strdup, strcmp
+#include <string.h> // strlen
 #include <ctype.h> // toupper
 
 #include "bst.h"
+#include "tokenizer.h"
+#include "str_arena.h"
+#include "outbuf.h"
+#include "wc_stats.h"
+#include "word_key.h"
+#include "word_dict.h"
+#include "word_batch.h"
+#include "word_counter.h"
 
 #define QUIT			1
 #define FORWARD_PRINT	2
@@ -14,33 +22,35 @@
 #define COUNT			7
 
 // User structure type definition
-// 단어 구조체
-typedef struct {
-	char	*word;		// 단어
-	int		freq;		// 빈도
-} tWord;
+// 단어 구조체(tWord)는 word_counter.h에 정의 (counting pass와 같이 사용)
+
+// 단어 문자열 저장소
+// 모든 단어 구조체의 word는 여기에 인터닝되며, 사전을 해제할 때 한 번에 해제
+static STRARENA *word_arena;
 
 ////////////////////////////////////////////////////////////////////////////////
-// 단어 구조체를 위한 메모리를 할당하고 word, freq 초기화
+// 단어 구조체를 위한 메모리를 할당하고 word, key, len, freq 초기화
 // return	할당된 단어 구조체에 대한 pointer
 //			NULL if overflow
 tWord *createWord( char *word){
 	tWord *pWord= (tWord *)malloc(sizeof(tWord));
 	
 	if(pWord != NULL){
-		pWord->word=strdup(word);
+		pWord->len=strlen(word);
+		pWord->word=(char *)strarena_Intern(word_arena, word, pWord->len);
+		pWord->key=wkey_Make(word, pWord->len);
 		pWord->freq=1;
 	}
 	return pWord;
 }
 
 // 단어 구조체에 할당된 메모리를 해제
+// 단어 문자열은 word_arena가 일괄 해제
 // for destroyList function
 void destroyWord( void *pNode){
 	tWord *wordNode= (tWord *) pNode;
 	
 	if(wordNode !=NULL){
-	free(wordNode->word);
 	free(wordNode);
 	}
 
@@ -81,21 +91,31 @@ int compare_by_word( const void *n1, const void *n2)
 	tWord *p1 = (tWord *)n1;
 	tWord *p2 = (tWord *)n2;
 	
-	return strcmp( p1->word, p2->word);
+	STATS_CMP();
+	// 앞 8바이트 키가 다르면 단어 문자열을 읽지 않음 (strcmp와 같은 순서)
+	return wkey_Compare( p1->key, p1->word, p1->len, p2->key, p2->word, p2->len);
 }
 
 // prints contents of word structure
 // for BST_Traverse and BST_TraverseR functions
 void print_word(const void *dataPtr)
 {
-	printf( "%s\t%d\n", ((tWord *)dataPtr)->word, ((tWord *)dataPtr)->freq);
+	OUTBUF *out = out_Stdout();
+	
+	out_Str( out, ((tWord *)dataPtr)->word);
+	out_Char( out, '\t');
+	out_Int( out, ((tWord *)dataPtr)->freq);
+	out_Char( out, '\n');
 }
 
 // prints word of word structure
 // for printTree function
 void print_word_only(const void *dataPtr)
 {
-	printf( "%s\n", ((tWord *)dataPtr)->word);
+	OUTBUF *out = out_Stdout();
+	
+	out_Str( out, ((tWord *)dataPtr)->word);
+	out_Char( out, '\n');
 }
 
 void increase_freq(void *dataPtr)
@@ -110,6 +130,251 @@ void input_word(char *word)
 	fscanf( stdin, "%s", word);
 }
 
+#ifdef WC_STATS
+////////////////////////////////////////////////////////////////////////////////
+// 벤치마크: 입력의 모든 단어를 사전(BST)에서 다시 찾음
+// return	찾은 단어의 수 (입력의 단어 수)
+static long stats_lookup( const char *filename, TREE *tree)
+{
+	TOKENIZER *tok = tok_Open( filename, TOK_CSTR);
+	tToken token;
+	tWord key;
+	long n = 0;
+	
+	if (tok == NULL) return 0;
+	
+	STATS_BEGIN();
+	while (tok_Next( tok, &token))
+	{
+		key.word = (char *)token.ptr;
+		key.len = token.len;
+		key.key = wkey_Make( token.ptr, token.len);
+		STATS_SINK( BST_Search( tree, &key) != NULL);
+		n++;
+	}
+	STATS_END( STATS_LOOKUP, n);
+	
+	tok_Close( tok);
+	return n;
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// 사전 생성의 counting pass
+// wcounter_Sorted가 빈도를 세어 서로 다른 단어 d개를 단어순으로 정렬(O(n + d log d))하면
+// BST_BuildSorted로 균형 트리를 연결(O(d))
+// (단어마다 BST_Insert하면 비교가 평균 O(n log d)이고, 정렬된 입력에서는 O(n d))
+
+// counting pass로 빈 트리에 사전을 만듦
+// return	1 if successful
+//			0 if overflow
+static int build_counted( TOKENIZER *tok, TREE *tree)
+{
+	int count, ok;
+	tWord **sorted = wcounter_Sorted( tok, word_arena, &count);
+	
+	if (sorted == NULL) return 0;
+	
+	ok = BST_BuildSorted( tree, (void **)sorted, count);
+	if (!ok) for (int i = 0; i < count; i++) destroyWord( sorted[i]);
+	
+	free( sorted);
+	return ok;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// 이진 사전 파일 (--save, --load)
+
+// 사전을 저장할 writer (save_word에서 사용)
+static WDICT_WRITER *dict_writer;
+
+// 단어 구조체를 dict_writer에 추가
+// for BST_Traverse function (단어순으로 호출됨)
+static void save_word( const void *dataPtr)
+{
+	const tWord *w = (const tWord *)dataPtr;
+	
+	wdict_Add( dict_writer, w->word, w->len, w->freq);
+}
+
+// 사전을 이진 사전 파일로 저장
+// return	1 if successful
+//			0 if the file cannot be written
+static int save_dict( const char *filename, TREE *tree)
+{
+	int ok;
+	
+	if ((dict_writer = wdict_Create()) == NULL) return 0;
+	
+	BST_Traverse( tree, save_word);
+	ok = wdict_Save( dict_writer, filename);
+	
+	wdict_Destroy( dict_writer);
+	dict_writer = NULL;
+	
+	return ok;
+}
+
+// prints index-th word of the loaded dictionary (print_word와 같은 형식)
+static void print_dict_word( const WDICT *dict, int index)
+{
+	OUTBUF *out = out_Stdout();
+	
+	out_Write( out, wdict_Word( dict, index), wdict_Len( dict, index));
+	out_Char( out, '\t');
+	out_Int( out, wdict_Freq( dict, index));
+	out_Char( out, '\n');
+}
+
+// 이진 사전 파일을 읽기 전용으로 매핑하여 질의에 답함 (단어 파일을 읽거나 사전을 만들지 않음)
+// 매핑된 사전은 수정할 수 없으므로 삭제 등은 지원하지 않음
+static int run_loaded( const char *filename)
+{
+	WDICT *dict = wdict_Open( filename);
+	char word[100];
+	int index;
+	
+	if (!dict)
+	{
+		fprintf( stderr, "Error: cannot load dictionary [%s]\n", filename);
+		return 2;
+	}
+	
+	fprintf( stderr, "Select Q)uit, P)rint, B)ackward print, T)ree print, S)earch, D)elete, C)ount: ");
+	
+	while (1)
+	{
+		int action = get_action();
+		
+		switch( action)
+		{
+			case QUIT:
+				wdict_Close( dict);
+				return 0;
+			
+			case FORWARD_PRINT:
+				for (int i = 0; i < wdict_Count( dict); i++) print_dict_word( dict, i);
+				break;
+			
+			case BACKWARD_PRINT:
+				for (int i = wdict_Count( dict) - 1; i >= 0; i--) print_dict_word( dict, i);
+				break;
+			
+			case SEARCH:
+				input_word(word);
+				
+				if ((index = wdict_Search( dict, word)) >= 0) print_dict_word( dict, index);
+				else fprintf( stdout, "%s not found\n", word);
+				break;
+			
+			case DELETE:
+				input_word(word);
+				fprintf( stdout, "not available for a loaded dictionary\n");
+				break;
+			
+			case TREE_PRINT:
+				fprintf( stdout, "not available for a loaded dictionary\n");
+				break;
+			
+			case COUNT:
+				fprintf( stdout, "%d\n", wdict_Count( dict));
+				break;
+		}
+		
+		// printf 출력과 print_dict_word(out_Stdout) 출력의 순서 유지
+		fflush( stdout);
+		out_Flush( out_Stdout());
+		
+		if (action) fprintf( stderr, "Select Q)uit, P)rint, B)ackward print, T)ree print, S)earch, D)elete, C)ount: ");
+	}
+	return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// 질의 파일 (--batch, --batch-each)
+
+// merge-join할 최소 run 길이
+// 질의 하나는 트리 높이만큼 비교하므로, run이 단어 수의 1/16 이상일 때만 순회 한 번이 더 빠름
+#define BATCH_MIN_RUN( count)	((count) / 16 + 2)
+
+// merge-join 중인 질의 파일 (match_word에서 사용)
+static WBATCH *batch;
+
+// 사전의 단어를 batch의 질의와 맞춤
+// for BST_Traverse function (단어순으로 호출됨)
+static void match_word( const void *dataPtr)
+{
+	wbatch_Match( batch, ((tWord *)dataPtr)->word, (void *)dataPtr);
+}
+
+// 질의 결과를 출력 (메뉴의 S)earch, D)elete와 같은 형식)
+static void print_result( const tQuery *q)
+{
+	OUTBUF *out = out_Stdout();
+	const tWord *w = (const tWord *)q->result;
+	
+	if (w == NULL)
+	{
+		out_Str( out, q->word);
+		out_Str( out, " not found\n");
+	}
+	else if (q->op == WBATCH_SEARCH) print_word( w);
+	else
+	{
+		out_Char( out, '(');
+		out_Str( out, w->word);
+		out_Str( out, ", ");
+		out_Int( out, w->freq);
+		out_Str( out, ") deleted\n");
+	}
+}
+
+// 질의 파일의 S, D를 차례로 처리하고 결과를 질의 순서대로 출력
+// merge이면 연속된 S를 단어순으로 정렬하여 중위 순회 한 번으로 답하고 (BATCH_MIN_RUN 이상일 때), 나머지는 질의마다 BST_Search
+// return	0 if successful
+//			2 if the query file cannot be read
+static int run_batch( const char *filename, TREE *tree, int merge)
+{
+	tWord key;
+	int end;
+	
+	if ((batch = wbatch_Load( filename)) == NULL) return 2;
+	
+	STATS_BEGIN();
+	for (int i = 0; i < batch->count; i = end)
+	{
+		end = merge ? wbatch_RunEnd( batch, i) : i;
+		if (end - i >= BATCH_MIN_RUN( BST_Count( tree)) && wbatch_Begin( batch, i, end))
+		{
+			BST_Traverse( tree, match_word);
+			for (int j = i; j < end; j++) print_result( &batch->queries[j]);
+			continue;
+		}
+		
+		// D 질의, 또는 merge-join하기에 짧은 run은 질의마다 처리
+		if (end == i) end = i + 1;
+		for (int j = i; j < end; j++)
+		{
+			tQuery *q = &batch->queries[j];
+			
+			key.word = q->word;
+			key.len = q->len;
+			key.key = wkey_Make( q->word, q->len);
+			if (q->op == WBATCH_SEARCH) q->result = BST_Search( tree, &key);
+			else q->result = BST_Delete( tree, &key);
+			
+			print_result( q);
+			if (q->op == WBATCH_DELETE && q->result) destroyWord( q->result);
+		}
+	}
+	STATS_END( STATS_LOOKUP, batch->count);
+	
+	out_Flush( out_Stdout());
+	wbatch_Close( batch);
+	batch = NULL;
+	return 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 int main( int argc, char **argv)
 {
@@ -117,16 +382,52 @@ int main( int argc, char **argv)
 	
 	char word[100];
 	tWord *pWord;
+	tWord key; // S)earch, D)elete의 탐색 키 (word는 입력 버퍼, 인터닝하지 않음)
 	int ret;
-	FILE *fp;
+	TOKENIZER *tok;
+	tToken token;
+	const char *save_file = NULL;
+	const char *batch_file = NULL;
+	int batch_merge = 1;
+	int build_insert = 0;
+	
+	// --insert : counting pass 대신 단어마다 BST_Insert하여 사전을 만듦 (비교용)
+	if (argc >= 2 && strcmp( argv[1], "--insert") == 0)
+	{
+		build_insert = 1;
+		argc--;
+		argv++;
+	}
+	
+	// --load DICT : 저장된 이진 사전으로 질의에 답함
+	if (argc == 3 && strcmp( argv[1], "--load") == 0) return run_loaded( argv[2]);
+	
+	// --save DICT FILE : 사전을 만든 뒤 이진 사전 파일로 저장
+	if (argc == 4 && strcmp( argv[1], "--save") == 0)
+	{
+		save_file = argv[2];
+		argc -= 2;
+		argv += 2;
+	}
+	
+	// --batch QUERIES FILE : 사전을 만든 뒤 메뉴 대신 질의 파일을 처리
+	// --batch-each QUERIES FILE : 같은 처리를 질의마다 탐색하여 수행 (비교용)
+	else if (argc == 4 && (strcmp( argv[1], "--batch") == 0 || strcmp( argv[1], "--batch-each") == 0))
+	{
+		batch_file = argv[2];
+		batch_merge = (strcmp( argv[1], "--batch") == 0);
+		argc -= 2;
+		argv += 2;
+	}
 	
 	if (argc != 2) {
-		fprintf( stderr, "usage: %s FILE\n", argv[0]);
+		fprintf( stderr, "usage: %s [--insert] [--save DICT | --batch QUERIES | --batch-each QUERIES] FILE\n", argv[0]);
+		fprintf( stderr, "       %s --load DICT\n", argv[0]);
 		return 1;
 	}
 	
-	fp = fopen( argv[1], "rt");
-	if (!fp)
+	tok = tok_Open( argv[1], TOK_CSTR);
+	if (!tok)
 	{
 		fprintf( stderr, "Error: cannot open file [%s]\n", argv[1]);
 		return 2;
@@ -134,15 +435,25 @@ int main( int argc, char **argv)
 	
 	// creates an empty tree
 	tree = BST_Create(compare_by_word);
-	if (!tree)
+	word_arena = strarena_Create();
+	if (!tree || !word_arena)
 	{
 		printf( "Cannot create a tree\n");
 		return 100;
 	}
 	
-	while(fscanf( fp, "%s", word) != EOF)
+	STATS_BEGIN();
+	if (!build_insert)
 	{
-		pWord = createWord( word);
+		if (!build_counted( tok, tree))
+		{
+			fprintf( stderr, "Error: cannot build the dictionary\n");
+			return 100;
+		}
+	}
+	else while(tok_Next( tok, &token))
+	{
+		pWord = createWord( (char *)token.ptr);
 		
 		ret = BST_Insert( tree, pWord, increase_freq);
 		
@@ -151,8 +462,30 @@ int main( int argc, char **argv)
 			destroyWord( pWord);
 		}
 	}
+	STATS_END( STATS_BUILD, 0);
 	
-	fclose( fp);
+	tok_Close( tok);
+
+#ifdef WC_STATS
+	STATS_OPS( STATS_BUILD, stats_lookup( argv[1], tree));
+#endif
+	
+	if (save_file && !save_dict( save_file, tree))
+	{
+		fprintf( stderr, "Error: cannot save dictionary [%s]\n", save_file);
+		BST_Destroy( tree, destroyWord);
+		strarena_Destroy( word_arena);
+		return 3;
+	}
+	
+	if (batch_file)
+	{
+		ret = run_batch( batch_file, tree, batch_merge);
+		STATS_REPORT( BST_Count( tree));
+		BST_Destroy( tree, destroyWord);
+		strarena_Destroy( word_arena);
+		return ret;
+	}
 	
 	fprintf( stderr, "Select Q)uit, P)rint, B)ackward print, T)ree print, S)earch, D)elete, C)ount: ");
 	
@@ -164,11 +497,16 @@ int main( int argc, char **argv)
 		switch( action)
 		{
 			case QUIT:
+				STATS_REPORT( BST_Count( tree));
 				BST_Destroy( tree, destroyWord);
+				strarena_Destroy( word_arena);
 				return 0;
 			
 			case FORWARD_PRINT:
+				STATS_BEGIN();
 				BST_Traverse( tree, print_word);
+				out_Flush( out_Stdout());
+				STATS_END( STATS_DUMP, BST_Count( tree));
 				break;
 			
 			case BACKWARD_PRINT:
@@ -182,27 +520,27 @@ int main( int argc, char **argv)
 			case SEARCH:
 				input_word(word);
 				
-				pWord = createWord( word);
+				key.word = word;
+				key.len = strlen( word);
+				key.key = wkey_Make( word, key.len);
 
-				if ((ptr = BST_Search( tree, pWord)) != NULL) print_word( ptr);
+				if ((ptr = BST_Search( tree, &key)) != NULL) print_word( ptr);
 				else fprintf( stdout, "%s not found\n", word);
-				
-				destroyWord( pWord);
 				break;
 				
 			case DELETE:
 				input_word(word);
 				
-				pWord = createWord( word);
+				key.word = word;
+				key.len = strlen( word);
+				key.key = wkey_Make( word, key.len);
 
-				if ((ptr = BST_Delete( tree, pWord)) != NULL)
+				if ((ptr = BST_Delete( tree, &key)) != NULL)
 				{
 					fprintf( stdout, "(%s, %d) deleted\n", ((tWord *)ptr)->word, ((tWord *)ptr)->freq);
 					destroyWord( ptr);
 				}
 				else fprintf( stdout, "%s not found\n", word);
-				
-				destroyWord( pWord);
 				break;
 			
 			case COUNT:
@@ -210,6 +548,10 @@ int main( int argc, char **argv)
 				break;
 		}
 		
+		// printf 출력과 print_word(out_Stdout) 출력의 순서 유지
+		fflush( stdout);
+		out_Flush( out_Stdout());
+		
 		if (action) fprintf( stderr, "Select Q)uit, P)rint, B)ackward print, T)ree print, S)earch, D)elete, C)ount: ");
 	}
 	return 0;
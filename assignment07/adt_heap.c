@@ -2,6 +2,14 @@
 #include <stdlib.h> // malloc, realloc, free
 
 #include "adt_heap.h"
+#include "outbuf.h"
+
+/* Places data at heapArr[index] and notifies its new position (indexed heap)
+*/
+static void _place( HEAP *heap, int index, void *data){
+	heap->heapArr[index]=data;
+	if(heap->set_index != NULL) heap->set_index(data, index);
+}
 
 /* Reestablishes heap by moving data in child up to correct location heap array
    for heap_Insert function
@@ -12,8 +20,8 @@ static void _reheapUp( HEAP *heap, int index){
 	int parentindex=(index-1)/2;
 	if(heap->compare(heap->heapArr[index], heap->heapArr[parentindex])>0){
 		void *temp = heap->heapArr[index];
-		heap->heapArr[index]=heap->heapArr[parentindex];
-		heap->heapArr[parentindex]=temp;
+		_place(heap, index, heap->heapArr[parentindex]);
+		_place(heap, parentindex, temp);
 		_reheapUp(heap, parentindex);
 	}
 }
@@ -50,8 +58,8 @@ static void _reheapDown( HEAP *heap, int index){
 	
 	if(largest != index){ //부모 노드가 더 작은 경우, 교환이 일어난 경우
 		void *temp=heap->heapArr[index];
-		heap->heapArr[index]=heap->heapArr[largest];
-		heap->heapArr[largest]=temp;
+		_place(heap, index, heap->heapArr[largest]);
+		_place(heap, largest, temp);
 		_reheapDown(heap, largest);
 	}
 }
@@ -74,7 +82,21 @@ HEAP *heap_Create( int (*compare) (const void *arg1, const void *arg2)){
 	heap->last=-1;
 	heap->capacity=10;
 	heap->compare=compare;
+	heap->set_index=NULL;
+	
+	return heap;
+}
+
+/* Allocates an indexed heap
+set_index(data, index) is called whenever data is placed at heapArr[index],
+so the caller can keep the position of each data for heap_Update
+if memory overflow, NULL returned
+*/
+HEAP *heap_CreateIndexed( int (*compare) (const void *arg1, const void *arg2), void (*set_index) (void *data, int index)){
+	HEAP *heap=heap_Create(compare);
+	if(heap==NULL) return NULL;
 	
+	heap->set_index=set_index;
 	return heap;
 }
 
@@ -104,7 +126,7 @@ int heap_Insert( HEAP *heap, void *dataPtr){
 	}
 	
 	(heap->last)++;
-	heap->heapArr[heap->last]=dataPtr;
+	_place(heap, heap->last, dataPtr);
 	_reheapUp(heap, heap->last);
 	return 1;
 }
@@ -118,12 +140,34 @@ int heap_Delete( HEAP *heap, void **dataOutPtr){
 	if(heap->last ==-1) return 0;
 	
 	*dataOutPtr=heap->heapArr[0];
-	heap->heapArr[0]=heap->heapArr[heap->last];
 	(heap->last)--;
-	_reheapDown(heap,0);
+	if(heap->last >= 0){
+		_place(heap, 0, heap->heapArr[heap->last+1]);
+		_reheapDown(heap,0);
+	}
 	return 1;
 }
 
+/* Returns root of heap without deleting it
+return NULL if heap empty
+*/
+void *heap_Top( HEAP *heap){
+	if(heap->last ==-1) return NULL;
+	
+	return heap->heapArr[0];
+}
+
+/* Reestablishes heap after the key of heapArr[index] has changed
+index는 set_index로 전달받은 위치 (indexed heap)
+*/
+void heap_Update( HEAP *heap, int index){
+	if(index < 0 || index > heap->last) return;
+	
+	// 키가 커졌으면 위로, 작아졌으면 아래로 이동 (둘 중 하나만 일어남)
+	_reheapUp(heap, index);
+	_reheapDown(heap, index);
+}
+
 /*
 return 1 if the heap is empty; 0 if not
 */
@@ -133,9 +177,13 @@ int heap_Empty(  HEAP *heap){
 
 /* Print heap array */
 void heap_Print( HEAP *heap, void (*print_func) (const void *data)){
+	OUTBUF *out=out_Stdout();
+	
+	fflush(stdout); // 앞서 printf로 출력한 내용을 먼저 내보냄
 	for(int i=0; i<=heap->last; i++){
 		print_func(heap->heapArr[i]);
 	}
-	printf("\n");
+	out_Char(out, '\n');
+	out_Flush(out);
 }
 
@@ -4,6 +4,7 @@ typedef struct
 	int	capacity;
 	void **heapArr;
 	int (*compare) (const void *, const void *);
+	void (*set_index) (void *, int);	// indexed heap: 원소의 위치가 바뀔 때마다 호출 (NULL이면 호출하지 않음)
 } HEAP;
 
 /* Allocates memory for heap and returns address of heap head structure
@@ -12,6 +13,13 @@ The initial capacity of the heap should be 10
 */
 HEAP *heap_Create( int (*compare) (const void *arg1, const void *arg2));
 
+/* Allocates an indexed heap
+set_index(data, index) is called whenever data is placed at heapArr[index],
+so the caller can keep the position of each data for heap_Update
+if memory overflow, NULL returned
+*/
+HEAP *heap_CreateIndexed( int (*compare) (const void *arg1, const void *arg2), void (*set_index) (void *data, int index));
+
 /* Free memory for heap
 */
 void heap_Destroy( HEAP *heap, void (*remove_data)(void *ptr));
@@ -26,11 +34,23 @@ return 1 if successful; 0 if heap empty
 */
 int heap_Delete( HEAP *heap, void **dataOutPtr);
 
+/* Returns root of heap without deleting it
+return NULL if heap empty
+*/
+void *heap_Top( HEAP *heap);
+
+/* Reestablishes heap after the key of heapArr[index] has changed
+index는 set_index로 전달받은 위치 (indexed heap)
+*/
+void heap_Update( HEAP *heap, int index);
+
 /*
 return 1 if the heap is empty; 0 if not
 */
 int heap_Empty(  HEAP *heap);
 
-/* Print heap array */
+/* Print heap array
+	print_func도 out_Stdout()으로 출력해야 함
+*/
 void heap_Print( HEAP *heap, void (*print_func) (const void *data));
 
@@ -3,6 +3,7 @@
 #include <time.h> // time
 
 #include "adt_heap.h"
+#include "outbuf.h"
 
 #define MAX_ELEM	20
 
@@ -19,7 +20,10 @@ int compare(const void *arg1, const void *arg2)
 /* user-defined print function */
 void print_func(const void *data)
 {
-	printf(" %4d", *(int *)data);
+	OUTBUF *out = out_Stdout();
+
+	out_Char(out, ' ');
+	out_IntPad(out, *(int *)data, 4);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
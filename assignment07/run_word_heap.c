@@ -1,7 +1,10 @@
 #include <stdio.h>
-#include <string.h> // strdup
+#include <string.h> // strlen, strcmp
 #include <stdlib.h>
 #include "adt_heap.h"
+#include "tokenizer.h"
+#include "str_arena.h"
+#include "outbuf.h"
 
 // User structure type definition
 // 단어 구조체
@@ -10,6 +13,10 @@ typedef struct {
 	int		freq;		// 빈도
 } tWord;
 
+// 단어 문자열 저장소
+// 모든 단어 구조체의 word는 여기에 인터닝되며, 사전을 해제할 때 한 번에 해제
+static STRARENA *word_arena;
+
 ////////////////////////////////////////////////////////////////////////////////
 // 단어 구조체를 위한 메모리를 할당하고 word, freq 초기화
 // return	할당된 단어 구조체에 대한 pointer
@@ -20,7 +27,7 @@ tWord *createWord( char *word, int freq)
 	
 	if (newWord == NULL) return NULL;
 	
-	newWord->word = strdup( word);
+	newWord->word = (char *)strarena_Intern( word_arena, word, strlen( word));
 	newWord->freq = freq;
 	
 	return newWord;
@@ -28,9 +35,9 @@ tWord *createWord( char *word, int freq)
 
 ////////////////////////////////////////////////////////////////////////////////
 // 단어 구조체에 할당된 메모리를 해제
+// 단어 문자열은 word_arena가 일괄 해제
 void destroyWord( void *pWord)
 {
-	free( ((tWord *)pWord)->word);
 	free( pWord);
 }
 
@@ -49,14 +56,22 @@ int compare_by_word( const void *n1, const void *n2)
 // prints contents of word structure
 void print_word(const void *dataPtr)
 {
-	printf( "%s\t%d\n", ((tWord *)dataPtr)->word, ((tWord *)dataPtr)->freq);
+	OUTBUF *out = out_Stdout();
+	
+	out_Str( out, ((tWord *)dataPtr)->word);
+	out_Char( out, '\t');
+	out_Int( out, ((tWord *)dataPtr)->freq);
+	out_Char( out, '\n');
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 // prints word of word structure
 void print_word_only(const void *dataPtr)
 {
-	printf( "%s\n", ((tWord *)dataPtr)->word);
+	OUTBUF *out = out_Stdout();
+	
+	out_Str( out, ((tWord *)dataPtr)->word);
+	out_Char( out, '\n');
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -65,10 +80,10 @@ int main( int argc, char **argv)
 	HEAP *heap;
 	void *dataPtr;
 	
-	char word[100];
+	tToken token;
 	int freq;
 	tWord *pWord;
-	FILE *fp;
+	TOKENIZER *tok;
 	
 	if (argc != 2)
 	{
@@ -76,20 +91,21 @@ int main( int argc, char **argv)
 		return 1;
 	}
 		
-	if ((fp = fopen(argv[1], "rt")) == NULL)
+	if ((tok = tok_Open(argv[1], TOK_CSTR)) == NULL)
 	{
 		fprintf( stderr, "file open error: %s\n", argv[1]);
 		return 2;
 	}
 	
 	heap = heap_Create(compare_by_word); // initial capacity = 10
+	word_arena = strarena_Create();
 	
 	printf("Insert:");
 	
-	while(fscanf(fp, "%s\t%d", word, &freq) != EOF)
+	while(tok_NextRecord(tok, &token, &freq))
 	{
-		printf(" %s", word); // 입력 단어
-		pWord = createWord(word, freq);
+		printf(" %s", token.ptr); // 입력 단어
+		pWord = createWord((char *)token.ptr, freq);
 		
 		// insert function call
 		if (heap_Insert(heap, pWord) == 0) {
@@ -98,12 +114,13 @@ int main( int argc, char **argv)
 		}
  	}
 	printf("\n");
-	fclose(fp);
+	tok_Close(tok);
 	
 	printf("Heap:  ");
 	heap_Print(heap, print_word_only);
 	
 	printf( "Delete: ");
+	fflush(stdout); // print_word는 out_Stdout으로 출력
 	
 	for (int i = 0; i < 10 && !heap_Empty(heap); i++)
 	{
@@ -114,9 +131,11 @@ int main( int argc, char **argv)
 
 		destroyWord(dataPtr);
  	}
+	out_Flush(out_Stdout());
 	printf("\n");
 	
 	heap_Destroy(heap, destroyWord);
+	strarena_Destroy(word_arena);
 	
 	return 0;
 }
@@ -4,6 +4,7 @@
 #include <stdio.h>
 
 #include "avlt.h"
+#include "outbuf.h"
 
 #define max(x, y)	(((x) > (y)) ? (x) : (y))
 
@@ -12,6 +13,7 @@ static NODE *rotateRight(NODE *root);
 static NODE *rotateLeft(NODE *root);
 static NODE *_insert(NODE *root, NODE *newPtr, int (*compare)(const void *, const void *), void (*callback)(void *), int *duplicated);
 static NODE *_makeNode(void *dataInPtr);
+static NODE *_buildSorted(void **dataInPtr, int lo, int hi, int *overflow);
 static void _destroy(NODE *root, void (*callback)(void *));
 static NODE *_delete(NODE *root, void *keyPtr, void **dataOutPtr, int (*compare)(const void *, const void *));
 static NODE *_search(NODE *root, void *keyPtr, int (*compare)(const void *, const void *));
@@ -81,6 +83,27 @@ static NODE *_makeNode( void *dataInPtr){
 	return node;
 }
 
+// used in AVLT_BuildSorted
+// 구간 [lo, hi)의 가운데 데이터를 루트로 하고 왼쪽, 오른쪽 구간으로 서브트리를 만듦 (재귀 깊이는 log n)
+// 왼쪽 구간이 오른쪽과 같거나 1 크므로 높이는 왼쪽 서브트리의 높이 + 1
+// return	pointer to root
+//			overflow이면 *overflow를 1로 (그때까지 만든 노드는 반환된 루트 아래에 연결되어 있음)
+static NODE *_buildSorted( void **dataInPtr, int lo, int hi, int *overflow){
+	if(lo>=hi || *overflow) return NULL;
+	
+	int mid=lo+(hi-lo)/2;
+	NODE *node=_makeNode(dataInPtr[mid]);
+	if(!node){
+		*overflow=1;
+		return NULL;
+	}
+	node->left=_buildSorted(dataInPtr, lo, mid, overflow);
+	node->right=_buildSorted(dataInPtr, mid+1, hi, overflow);
+	node->height=getHeight(node->left)+1;
+	
+	return node;
+}
+
 // used in AVLT_Destroy
 static void _destroy( NODE *root, void (*callback)(void *)){
 	if(!root) return; 
@@ -189,7 +212,7 @@ static void _inorder_print( NODE *root, int level, void (*callback)(const void *
 	if(root){
 		_inorder_print(root->right, level+1, callback);
 		for(int i=0; i<level; i++){
-			printf("\t");
+			out_Char(out_Stdout(), '\t');
 		}			
 		callback(root->dataPtr);
 		_inorder_print(root->left, level+1, callback);
@@ -280,6 +303,25 @@ int AVLT_Insert( TREE *pTree, void *dataInPtr, void (*callback)(void *)){
 	return 1;
 }
 	
+/* Builds a balanced tree from count data sorted by compare (중복 없는 오름차순)
+	빈 트리에 하나씩 삽입하지 않고 가운데 데이터를 루트로 하여 O(n)에 만듦 (compare는 호출하지 않음)
+	return	1 success
+			0 overflow or the tree is not empty (트리는 빈 상태로 남음)
+*/
+int AVLT_BuildSorted( TREE *pTree, void **dataInPtr, int count){
+	if(!pTree || pTree->root) return 0;
+	
+	int overflow=0;
+	pTree->root=_buildSorted(dataInPtr, 0, count, &overflow);
+	if(overflow){
+		_destroy(pTree->root, NULL);
+		pTree->root=NULL;
+		return 0;
+	}
+	pTree->count=count;
+	return 1;
+}
+	
 /* Deletes a node with keyPtr from the tree
 	return	address of data of the node containing the key
 			NULL not found
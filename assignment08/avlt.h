@@ -36,6 +36,14 @@ void AVLT_Destroy( TREE *pTree, void (*callback)(void *));
 */
 int AVLT_Insert( TREE *pTree, void *dataInPtr, void (*callback)(void *));
 
+/* Builds a balanced tree from count data sorted by compare (중복 없는 오름차순)
+	빈 트리에 하나씩 삽입하지 않고 가운데 데이터를 루트로 하여 O(n)에 만듦 (compare는 호출하지 않음)
+	각 노드의 height도 설정되므로 이후의 삽입, 삭제는 그대로 균형을 유지
+	return	1 success
+			0 overflow or the tree is not empty (트리는 빈 상태로 남음)
+*/
+int AVLT_BuildSorted( TREE *pTree, void **dataInPtr, int count);
+
 /* Deletes a node with keyPtr from the tree
 	return	address of data of the node containing the key
 			NULL not found
@@ -57,6 +65,7 @@ void AVLT_Traverse( TREE *pTree, void (*callback)(const void *));
 void AVLT_TraverseR( TREE *pTree, void (*callback)(const void *));
 
 /* Print tree using right-to-left inorder traversal with level
+	레벨만큼의 탭은 out_Stdout()으로 출력하므로 callback도 같은 writer를 사용해야 함
 */
 void printTree( TREE *pTree, void (*callback)(const void *));
 
@@ -3,6 +3,10 @@
 #include <string.h> // strdup
 #include <ctype.h> // isupper, tolower
 
+#include "tokenizer.h"
+#include "str_arena.h"
+#include "outbuf.h"
+
 #define MAX_DEGREE 27 // 'a' ~ 'z' and EOW //각 노드에서 분기할 수 있는 방향이 27
 #define EOW '$' // end of word
 
@@ -106,7 +110,13 @@ static int trieList_main(TRIE *root, char *dic[], int count) {
     if (root == NULL) return count;
 
     if (root->index != -1) { //현재 노드가 단어의 끝을 나타내는 경우
-       printf("[%d] %s\n", count + 1, dic[root->index]);
+        OUTBUF *out = out_Stdout();
+
+        out_Char(out, '[');
+        out_Int(out, count + 1);
+        out_Write(out, "] ", 2);
+        out_Str(out, dic[root->index]);
+        out_Char(out, '\n');
         count++;
     }
 
@@ -119,7 +129,9 @@ static int trieList_main(TRIE *root, char *dic[], int count) {
 void trieList(TRIE *root, char *dic[]) {
     if (root == NULL) return;
 
+    fflush(stdout); // 앞서 printf로 출력한 내용을 먼저 내보냄
     trieList_main(root, dic, 0);
+    out_Flush(out_Stdout());
 }
 
 
@@ -243,11 +255,12 @@ void trieSearchWildcard( TRIE *root, char *str, char *dic[])
 int main(int argc, char **argv) {
     TRIE *permute_trie; //루트 노드 가리킬 포인터
     char *dic[100000]; //배열 동적으로 할당하면 더 좋을것임
+    STRARENA *dic_arena; // dic[]의 단어 문자열 저장소 (한 번에 해제)
 
     int ret;
     char str[100]; //정교하면 하면 더 좋음
-    FILE *fp;
-    char *permuterms[100];
+    TOKENIZER *tok;
+    tToken token;
     int num_p; // # of permuterms
     int num_words = 0;
 
@@ -256,26 +269,29 @@ int main(int argc, char **argv) {
         return 1;
     }
 
-    fp = fopen(argv[1], "rt");
-    if (fp == NULL) {
+    tok = tok_Open(argv[1], TOK_CSTR);
+    if (tok == NULL) {
         fprintf(stderr, "File open error: %s\n", argv[1]);
         return 1;
     }
 
     permute_trie = trieCreateNode(); // trie for permuterm index
+    dic_arena = strarena_Create();
+
+    while (tok_Next(tok, &token)) {
+        char *permuterms[token.len + 1]; // 단어 길이 + 1 (EOW)개의 permuterm
 
-    while (fscanf(fp, "%s", str) != EOF) {
-        num_p = make_permuterms(str, permuterms);
+        num_p = make_permuterms((char *)token.ptr, permuterms);
 
         for (int i = 0; i < num_p; i++)
             trieInsert(permute_trie, permuterms[i], num_words);
 
         clear_permuterms(permuterms, num_p);
 
-        dic[num_words++] = strdup(str);
+        dic[num_words++] = (char *)strarena_Intern(dic_arena, token.ptr, token.len);
     }
 
-    fclose(fp);
+    tok_Close(tok);
 
     printf("\nQuery: ");
     while (fscanf(stdin, "%s", str) != EOF) {
@@ -293,8 +309,7 @@ int main(int argc, char **argv) {
         printf("\nQuery: ");
     }
 
-    for (int i = 0; i < num_words; i++)
-        free(dic[i]);
+    strarena_Destroy(dic_arena);
 
     trieDestroy(permute_trie);
 
@@ -0,0 +1,199 @@
+#include <stdio.h>
+#include <stdlib.h> // malloc, free, qsort, atol, mkstemp
+#include <string.h> // strcmp, strdup, strchr
+#include <unistd.h> // close, unlink, getopt
+
+#include "tokenizer.h"
+#include "bench_util.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// 질의 파일 처리 비교 (--batch와 --batch-each)
+// 단어 파일의 단어(와 사전에 없는 단어)로 질의 파일을 만든 뒤, 각 backend를 두 방식으로 실행
+//	each	질의마다 사전을 탐색 (메뉴의 S)earch, D)elete와 같음)
+//	batch	연속된 S 질의를 정렬하여 사전의 단어순 순회 한 번과 merge-join
+// 시간은 backend가 -DWC_STATS로 보고하는 질의 처리 구간 (lookup_ms, 사전 생성 제외)
+// 두 방식의 출력이 같은지도 확인
+//
+// backend,queries,each_ms,batch_ms,speedup,same_output
+
+// backend 정의 (bench 디렉토리에 빌드된 메뉴 방식 실행 파일)
+static const struct {
+	const char	*name;
+	const char	*program;
+} backends[] = {
+	{ "dlist",		"word_count4" },
+	{ "adt_dlist",	"word_count5" },
+	{ "skiplist",	"word_count5_skiplist" },
+	{ "unrolled",	"word_count5_unrolled" },
+	{ "bst",		"word_count6" },
+	{ "avlt",		"word_count7" },
+};
+#define NUM_BACKENDS	(int)(sizeof(backends) / sizeof(backends[0]))
+
+////////////////////////////////////////////////////////////////////////////////
+static int compare_str( const void *p1, const void *p2)
+{
+	return strcmp( *(char * const *)p1, *(char * const *)p2);
+}
+
+// 단어 파일의 서로 다른 단어들
+// return	단어 수
+//			-1 if the file cannot be opened
+static int load_vocab( const char *filename, char ***vocab)
+{
+	TOKENIZER *tok = tok_Open( filename, TOK_CSTR);
+	tToken token;
+	int n = 0, cap = 1024, m = 0;
+	char **words;
+
+	if (tok == NULL) return -1;
+
+	words = (char **)malloc( cap * sizeof(char *));
+	while (tok_Next( tok, &token))
+	{
+		if (n == cap)
+		{
+			cap *= 2;
+			words = (char **)realloc( words, cap * sizeof(char *));
+		}
+		words[n++] = strdup( token.ptr);
+	}
+	tok_Close( tok);
+
+	qsort( words, n, sizeof(char *), compare_str);
+	for (int i = 0; i < n; i++)
+	{
+		if (m > 0 && strcmp( words[m - 1], words[i]) == 0) free( words[i]);
+		else words[m++] = words[i];
+	}
+
+	*vocab = words;
+	return m;
+}
+
+// 질의 파일 생성
+// miss%는 사전에 없는 단어(단어 뒤에 '~'), del%는 D 질의
+static int write_queries( const char *path, char **vocab, int nvocab, long nqueries, int miss, int del)
+{
+	FILE *fp = fopen( path, "w");
+
+	if (fp == NULL) return 0;
+
+	for (long i = 0; i < nqueries; i++)
+	{
+		const char *word = vocab[bench_Rand() % nvocab];
+		char op = ((long)(bench_Rand() % 100) < del) ? 'D' : 'S';
+
+		if ((long)(bench_Rand() % 100) < miss) fprintf( fp, "%c %s~\n", op, word);
+		else fprintf( fp, "%c %s\n", op, word);
+	}
+	return fclose( fp) == 0;
+}
+
+// backend를 mode(--batch 또는 --batch-each)로 한 번 실행하고 표준 출력을 out에 저장
+// return	질의 처리 시간 (ms)
+//			-1 if the backend failed
+static double run_backend( const char *bindir, const char *program, const char *mode,
+						   const char *queries, const char *input, const char *out)
+{
+	char path[512];
+	char *argv[] = { path, (char *)mode, (char *)queries, (char *)input, NULL };
+
+	snprintf( path, sizeof(path), "%s/%s", bindir, program);
+	return bench_RunLookup( argv, out, NULL);
+}
+
+// 쉼표로 구분된 목록에 name이 있는지 확인 (list가 NULL이면 모두 선택)
+static int selected( const char *list, const char *name)
+{
+	size_t len = strlen( name);
+
+	if (list == NULL) return 1;
+
+	for (const char *p = list; p != NULL; p = strchr( p, ','))
+	{
+		if (*p == ',') p++;
+		if (strncmp( p, name, len) == 0 && (p[len] == ',' || p[len] == '\0')) return 1;
+	}
+	return 0;
+}
+
+static void usage( const char *prog)
+{
+	fprintf( stderr, "Usage: %s [-q QUERIES] [-m MISS%%] [-d DELETE%%] [-b BACKENDS] [FILE]\n\n", prog);
+	fprintf( stderr, "\t-q QUERIES\tnumber of queries (default 1000000)\n");
+	fprintf( stderr, "\t-m MISS%%\tpercentage of words not in the dictionary (default 10)\n");
+	fprintf( stderr, "\t-d DELETE%%\tpercentage of D queries (default 0)\n");
+	fprintf( stderr, "\t-b BACKENDS\tcomma separated: dlist,adt_dlist,skiplist,unrolled,bst,avlt\n");
+	fprintf( stderr, "\tFILE\t\tword file (default ../assignment05/words.txt)\n");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int main( int argc, char **argv)
+{
+	const char *filename = "../assignment05/words.txt";
+	const char *blist = NULL, *bindir = ".";
+	long nqueries = 1000000;
+	int miss = 10, del = 0;
+	char queries[] = "/tmp/wc_queries.XXXXXX";
+	char out_each[] = "/tmp/wc_each.XXXXXX";
+	char out_batch[] = "/tmp/wc_batch.XXXXXX";
+	char **vocab;
+	int nvocab, opt;
+
+	while ((opt = getopt( argc, argv, "q:m:d:b:")) != -1)
+	{
+		switch (opt)
+		{
+			case 'q': nqueries = atol( optarg); break;
+			case 'm': miss = atoi( optarg); break;
+			case 'd': del = atoi( optarg); break;
+			case 'b': blist = optarg; break;
+			default: usage( argv[0]); return 1;
+		}
+	}
+	if (optind < argc) filename = argv[optind];
+	if (nqueries < 1 || miss < 0 || miss > 100 || del < 0 || del > 100)
+	{
+		usage( argv[0]);
+		return 1;
+	}
+
+	if ((nvocab = load_vocab( filename, &vocab)) <= 0)
+	{
+		fprintf( stderr, "cannot read words from file : %s\n", filename);
+		return 1;
+	}
+
+	close( mkstemp( queries));
+	close( mkstemp( out_each));
+	close( mkstemp( out_batch));
+	if (!write_queries( queries, vocab, nvocab, nqueries, miss, del))
+	{
+		fprintf( stderr, "cannot write queries : %s\n", queries);
+		return 2;
+	}
+
+	printf( "backend,queries,each_ms,batch_ms,speedup,same_output\n");
+	for (int i = 0; i < NUM_BACKENDS; i++)
+	{
+		double each_ms, batch_ms;
+
+		if (!selected( blist, backends[i].name)) continue;
+
+		each_ms = run_backend( bindir, backends[i].program, "--batch-each", queries, filename, out_each);
+		batch_ms = run_backend( bindir, backends[i].program, "--batch", queries, filename, out_batch);
+
+		if (each_ms < 0 || batch_ms < 0) printf( "%s,%ld,,,,\n", backends[i].name, nqueries);
+		else printf( "%s,%ld,%.1f,%.1f,%.1f,%d\n", backends[i].name, nqueries, each_ms, batch_ms,
+					 each_ms / batch_ms, bench_SameFile( out_each, out_batch));
+		fflush( stdout);
+	}
+
+	unlink( queries);
+	unlink( out_each);
+	unlink( out_batch);
+	for (int i = 0; i < nvocab; i++) free( vocab[i]);
+	free( vocab);
+	return 0;
+}
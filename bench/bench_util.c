@@ -0,0 +1,169 @@
+#include <stdio.h>
+#include <string.h> // strlen, strstr, memcmp, memmove
+#include <unistd.h> // fork, execv, pipe, dup2, alarm
+#include <fcntl.h> // open
+#include <sys/wait.h> // wait4
+
+#include "bench_util.h"
+
+#define MAX_STDERR		4096	// bench_RunLookup에서 backend의 표준 에러를 읽는 버퍼 크기
+
+////////////////////////////////////////////////////////////////////////////////
+static unsigned long long rng_state = 88172645463325252ULL;
+
+/* Returns the next random number of *state (thread마다 따로 쓰는 generator)
+	*state는 0이 아니어야 함
+*/
+unsigned long long bench_RandR( unsigned long long *state)
+{
+	*state ^= *state >> 12;
+	*state ^= *state << 25;
+	*state ^= *state >> 27;
+	return *state * 2685821657736338717ULL;
+}
+
+/* Returns the next random number of the shared generator
+	모든 bench가 같은 초기 상태에서 시작하므로 실행마다 같은 수열
+*/
+unsigned long long bench_Rand( void)
+{
+	return bench_RandR( &rng_state);
+}
+
+/* Returns a random number in [0, 1) of the shared generator
+*/
+double bench_RandDouble( void)
+{
+	return (bench_Rand() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/* Runs argv[0] with arguments argv (NULL로 끝남) in a child process and waits for it
+	input이 NULL이 아니면 표준 입력으로 보냄 (NULL이면 /dev/null)
+	표준 출력은 out 파일 (NULL이면 /dev/null)
+	표준 에러는 마지막 부분만 text에 저장 ('\0'으로 끝남, 크기 size)
+	버퍼가 차면 뒤쪽 절반만 남기므로 size / 2보다 짧은 마지막 줄(stats 줄)은 잘리지 않음
+	timeout이 0보다 크면 timeout초 뒤 SIGALRM으로 종료
+	ru가 NULL이 아니면 자식 프로세스의 자원 사용량 (최대 RSS 등)
+	return	waitpid의 status
+			-1 if the child cannot be started
+*/
+int bench_Run( char *const argv[], const char *input, const char *out, int timeout,
+			   char *text, size_t size, struct rusage *ru)
+{
+	size_t len = 0, cap = size - 1;
+	int errpipe[2], inpipe[2];
+	int status;
+	pid_t pid;
+
+	if (pipe( errpipe) < 0) return -1;
+	if (pipe( inpipe) < 0)
+	{
+		close( errpipe[0]);
+		close( errpipe[1]);
+		return -1;
+	}
+
+	pid = fork();
+	if (pid == 0)
+	{
+		int fd = out ? open( out, O_WRONLY | O_CREAT | O_TRUNC, 0644) : open( "/dev/null", O_WRONLY);
+
+		if (fd < 0) _exit( 127);
+		dup2( fd, 1);
+		dup2( errpipe[1], 2);
+		if (input) dup2( inpipe[0], 0);
+		else
+		{
+			int devnull = open( "/dev/null", O_RDONLY);
+
+			if (devnull >= 0) dup2( devnull, 0);
+		}
+		close( inpipe[1]);
+		close( errpipe[0]);
+
+		if (timeout > 0) alarm( timeout); // 시간 초과 시 SIGALRM으로 종료
+
+		execv( argv[0], argv);
+		_exit( 127);
+	}
+	close( inpipe[0]);
+	close( errpipe[1]);
+	if (pid < 0)
+	{
+		close( inpipe[1]);
+		close( errpipe[0]);
+		return -1;
+	}
+
+	if (input && write( inpipe[1], input, strlen( input)) < 0) { /* backend가 먼저 종료됨 */ }
+	close( inpipe[1]);
+
+	for (;;)
+	{
+		ssize_t n = read( errpipe[0], text + len, cap - len);
+
+		if (n <= 0) break;
+		len += n;
+		// 버퍼가 차면 뒤쪽 절반만 남김 (메뉴 방식은 프롬프트가 많음)
+		// stats 줄은 마지막에 출력되고 절반보다 짧으므로, 쓰는 중인 stats 줄의 시작은 항상 뒤쪽 절반에 있음
+		if (len == cap)
+		{
+			memmove( text, text + cap / 2, cap - cap / 2);
+			len = cap - cap / 2;
+		}
+	}
+	text[len] = '\0';
+	close( errpipe[0]);
+
+	if (ru) wait4( pid, &status, 0, ru);
+	else waitpid( pid, &status, 0);
+	return status;
+}
+
+/* Runs a -DWC_STATS backend like bench_Run (표준 입력 없음, 시간 제한 없음)
+	stats 줄의 lookup_ms와 lookup_cmp(cmp가 NULL이 아니면)를 읽음
+	return	질의 처리 시간 lookup_ms
+			-1 if the backend failed or printed no stats line
+*/
+double bench_RunLookup( char *const argv[], const char *out, unsigned long long *cmp)
+{
+	char text[MAX_STDERR];
+	const char *line;
+	double lookup_ms;
+	int status = bench_Run( argv, NULL, out, 0, text, sizeof(text), NULL);
+
+	if (status < 0 || !WIFEXITED( status) || WEXITSTATUS( status) != 0) return -1;
+
+	line = strstr( text, "lookup_ms=");
+	if (line == NULL || sscanf( line, "lookup_ms=%lf", &lookup_ms) != 1) return -1;
+	if (cmp)
+	{
+		line = strstr( text, "lookup_cmp=");
+		if (line == NULL || sscanf( line, "lookup_cmp=%llu", cmp) != 1) return -1;
+	}
+	return lookup_ms;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/* return	1 if the two files have the same contents
+			0 if not, or a file cannot be opened
+*/
+int bench_SameFile( const char *p1, const char *p2)
+{
+	FILE *f1 = fopen( p1, "rb"), *f2 = fopen( p2, "rb");
+	int same = (f1 != NULL && f2 != NULL);
+	char b1[65536], b2[65536];
+
+	while (same)
+	{
+		size_t n1 = fread( b1, 1, sizeof(b1), f1);
+		size_t n2 = fread( b2, 1, sizeof(b2), f2);
+
+		if (n1 != n2 || memcmp( b1, b2, n1) != 0) same = 0;
+		if (n1 == 0) break;
+	}
+	if (f1) fclose( f1);
+	if (f2) fclose( f2);
+	return same;
+}
@@ -0,0 +1,54 @@
+#include <stddef.h> // size_t
+#include <sys/resource.h> // struct rusage
+
+////////////////////////////////////////////////////////////////////////////////
+// bench 프로그램이 같이 쓰는 함수
+// 재현 가능한 의사 난수, backend 실행 파일의 실행과 -DWC_STATS 측정 결과(stats 줄) 읽기, 출력 비교
+
+////////////////////////////////////////////////////////////////////////////////
+// 재현 가능한 의사 난수 (xorshift64*)
+
+/* Returns the next random number of the shared generator
+	모든 bench가 같은 초기 상태에서 시작하므로 실행마다 같은 수열
+*/
+unsigned long long bench_Rand( void);
+
+/* Returns a random number in [0, 1) of the shared generator
+*/
+double bench_RandDouble( void);
+
+/* Returns the next random number of *state (thread마다 따로 쓰는 generator)
+	*state는 0이 아니어야 함
+*/
+unsigned long long bench_RandR( unsigned long long *state);
+
+////////////////////////////////////////////////////////////////////////////////
+// backend 실행
+
+/* Runs argv[0] with arguments argv (NULL로 끝남) in a child process and waits for it
+	input이 NULL이 아니면 표준 입력으로 보냄 (NULL이면 /dev/null)
+	표준 출력은 out 파일 (NULL이면 /dev/null)
+	표준 에러는 마지막 부분만 text에 저장 ('\0'으로 끝남, 크기 size)
+	버퍼가 차면 뒤쪽 절반만 남기므로 size / 2보다 짧은 마지막 줄(stats 줄)은 잘리지 않음
+	timeout이 0보다 크면 timeout초 뒤 SIGALRM으로 종료
+	ru가 NULL이 아니면 자식 프로세스의 자원 사용량 (최대 RSS 등)
+	return	waitpid의 status
+			-1 if the child cannot be started
+*/
+int bench_Run( char *const argv[], const char *input, const char *out, int timeout,
+			   char *text, size_t size, struct rusage *ru);
+
+/* Runs a -DWC_STATS backend like bench_Run (표준 입력 없음, 시간 제한 없음)
+	stats 줄의 lookup_ms와 lookup_cmp(cmp가 NULL이 아니면)를 읽음
+	return	질의 처리 시간 lookup_ms
+			-1 if the backend failed or printed no stats line
+*/
+double bench_RunLookup( char *const argv[], const char *out, unsigned long long *cmp);
+
+////////////////////////////////////////////////////////////////////////////////
+// 출력 비교
+
+/* return	1 if the two files have the same contents
+			0 if not, or a file cannot be opened
+*/
+int bench_SameFile( const char *p1, const char *p2);
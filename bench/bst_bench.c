@@ -0,0 +1,430 @@
+#include <stdio.h>
+#include <stdlib.h> // malloc, free, atol
+#include <unistd.h> // getopt
+#include <time.h> // clock_gettime
+
+#include "bst.h"
+#include "bench_util.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// bst.c의 반복문 연산과 재귀 연산(이전 구현을 아래에 그대로 둠) 비교
+//	random	무작위 순서로 넣은 키 (균형에 가까운 트리)
+//	sorted	오름차순으로 넣은 키 (오른쪽으로만 이어진 사슬, 삽입이 O(n^2))
+//	chain	오름차순 사슬을 삽입 없이 직접 연결 (기본 10M 노드)
+//			재귀 연산은 깊이만큼 스택을 쓰므로 -r보다 깊으면 재귀 쪽은 측정하지 않음
+//
+// shape,nodes,op,iterative_ms,recursive_ms
+
+static int compare_int( const void *p1, const void *p2)
+{
+	int a = *(const int *)p1, b = *(const int *)p2;
+
+	return (a > b) - (a < b);
+}
+
+static void no_dup( void *dataPtr)
+{
+	(void)dataPtr;
+}
+
+static long sum; // 순회 결과 (최적화로 없어지지 않도록)
+
+static void sum_key( const void *dataPtr)
+{
+	sum += *(const int *)dataPtr;
+}
+
+static double now_ms( void)
+{
+	struct timespec ts;
+
+	clock_gettime( CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// 재귀 구현 (비교용)
+
+static int rec_insert( NODE *root, NODE *newPtr, int (*compare)(const void *, const void *))
+{
+	int cmp = compare( newPtr->dataPtr, root->dataPtr);
+
+	if (cmp < 0)
+	{
+		if (root->left) return rec_insert( root->left, newPtr, compare);
+		root->left = newPtr;
+		return 1;
+	}
+	if (cmp > 0)
+	{
+		if (root->right) return rec_insert( root->right, newPtr, compare);
+		root->right = newPtr;
+		return 1;
+	}
+	return 2;
+}
+
+static NODE *rec_search( NODE *root, void *keyPtr, int (*compare)(const void *, const void *))
+{
+	int cmp;
+
+	if (!root) return NULL;
+	cmp = compare( keyPtr, root->dataPtr);
+	if (cmp < 0) return rec_search( root->left, keyPtr, compare);
+	if (cmp > 0) return rec_search( root->right, keyPtr, compare);
+	return root;
+}
+
+static NODE *rec_delete( NODE *root, void *keyPtr, void **dataOutPtr, int (*compare)(const void *, const void *))
+{
+	int cmp;
+
+	if (!root) return NULL;
+	cmp = compare( keyPtr, root->dataPtr);
+	if (cmp < 0) root->left = rec_delete( root->left, keyPtr, dataOutPtr, compare);
+	else if (cmp > 0) root->right = rec_delete( root->right, keyPtr, dataOutPtr, compare);
+	else
+	{
+		NODE *delNode = root;
+
+		if (!root->left) root = root->right;
+		else if (!root->right) root = root->left;
+		else
+		{
+			NODE *parent = root;
+			NODE *successor = root->right;
+
+			if (!successor->left)
+			{
+				successor->left = root->left;
+				root = successor;
+			}
+			else
+			{
+				while (successor->left)
+				{
+					parent = successor;
+					successor = parent->left;
+				}
+				parent->left = successor->right;
+				successor->left = root->left;
+				successor->right = root->right;
+				root = successor;
+			}
+		}
+		*dataOutPtr = delNode->dataPtr;
+		free( delNode);
+	}
+	return root;
+}
+
+static void rec_traverse( NODE *root, void (*callback)(const void *))
+{
+	if (root)
+	{
+		rec_traverse( root->left, callback);
+		callback( root->dataPtr);
+		rec_traverse( root->right, callback);
+	}
+}
+
+static void rec_traverseR( NODE *root, void (*callback)(const void *))
+{
+	if (root)
+	{
+		rec_traverseR( root->right, callback);
+		callback( root->dataPtr);
+		rec_traverseR( root->left, callback);
+	}
+}
+
+static void rec_destroy( NODE *root)
+{
+	if (root)
+	{
+		rec_destroy( root->left);
+		rec_destroy( root->right);
+		free( root);
+	}
+}
+
+static int rec_Insert( TREE *pTree, void *dataInPtr)
+{
+	NODE *newPtr = (NODE *)malloc( sizeof(NODE));
+
+	newPtr->dataPtr = dataInPtr;
+	newPtr->left = newPtr->right = NULL;
+	if (!pTree->root) pTree->root = newPtr;
+	else if (rec_insert( pTree->root, newPtr, pTree->compare) == 2)
+	{
+		free( newPtr);
+		return 2;
+	}
+	pTree->count++;
+	return 1;
+}
+
+static void *rec_Delete( TREE *pTree, void *keyPtr)
+{
+	void *dataOut = NULL;
+
+	pTree->root = rec_delete( pTree->root, keyPtr, &dataOut, pTree->compare);
+	if (dataOut) pTree->count--;
+	return dataOut;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+static void print_row( const char *shape, long n, const char *op, double it_ms, double rec_ms)
+{
+	if (rec_ms < 0) printf( "%s,%ld,%s,%.1f,\n", shape, n, op, it_ms);
+	else printf( "%s,%ld,%s,%.1f,%.1f\n", shape, n, op, it_ms, rec_ms);
+	fflush( stdout);
+}
+
+// keys[0..n-1] 순서로 넣은 트리에서 두 구현을 비교
+// 두 구현이 같은 결과를 내는지 확인 (다르면 0)
+static int run_inserted( const char *shape, int *keys, long n)
+{
+	TREE *it = BST_Create( compare_int), *rec = BST_Create( compare_int);
+	double start, it_ms, rec_ms;
+	long it_sum, rec_sum, found = 0;
+	int ok = 1;
+
+	start = now_ms();
+	for (long i = 0; i < n; i++) BST_Insert( it, &keys[i], no_dup);
+	it_ms = now_ms() - start;
+	start = now_ms();
+	for (long i = 0; i < n; i++) rec_Insert( rec, &keys[i]);
+	rec_ms = now_ms() - start;
+	print_row( shape, n, "insert", it_ms, rec_ms);
+
+	start = now_ms();
+	for (long i = 0; i < n; i++) found += (BST_Search( it, &keys[i]) != NULL);
+	it_ms = now_ms() - start;
+	start = now_ms();
+	for (long i = 0; i < n; i++) found -= (rec_search( rec->root, &keys[i], compare_int) != NULL);
+	rec_ms = now_ms() - start;
+	print_row( shape, n, "search", it_ms, rec_ms);
+	if (found != 0) ok = 0;
+
+	sum = 0;
+	start = now_ms();
+	BST_Traverse( it, sum_key);
+	it_ms = now_ms() - start;
+	it_sum = sum;
+	sum = 0;
+	start = now_ms();
+	rec_traverse( rec->root, sum_key);
+	rec_ms = now_ms() - start;
+	rec_sum = sum;
+	print_row( shape, n, "traverse", it_ms, rec_ms);
+	if (it_sum != rec_sum) ok = 0;
+
+	start = now_ms();
+	BST_TraverseR( it, sum_key);
+	it_ms = now_ms() - start;
+	start = now_ms();
+	rec_traverseR( rec->root, sum_key);
+	rec_ms = now_ms() - start;
+	print_row( shape, n, "traverseR", it_ms, rec_ms);
+
+	// 절반을 삭제 (짝수 번째에 넣은 키)
+	start = now_ms();
+	for (long i = 0; i < n; i += 2) ok &= (BST_Delete( it, &keys[i]) == &keys[i]);
+	it_ms = now_ms() - start;
+	start = now_ms();
+	for (long i = 0; i < n; i += 2) ok &= (rec_Delete( rec, &keys[i]) == &keys[i]);
+	rec_ms = now_ms() - start;
+	print_row( shape, n, "delete_half", it_ms, rec_ms);
+	if (BST_Count( it) != rec->count) ok = 0;
+
+	start = now_ms();
+	BST_Destroy( it, NULL);
+	it_ms = now_ms() - start;
+	start = now_ms();
+	rec_destroy( rec->root);
+	free( rec);
+	rec_ms = now_ms() - start;
+	print_row( shape, n, "destroy", it_ms, rec_ms);
+
+	return ok;
+}
+
+// keys[0..n-1] (오름차순)을 오른쪽 사슬로 직접 연결
+static TREE *make_chain( int *keys, long n)
+{
+	TREE *tree = BST_Create( compare_int);
+	NODE **link = &tree->root;
+
+	for (long i = 0; i < n; i++)
+	{
+		NODE *node = (NODE *)malloc( sizeof(NODE));
+
+		node->dataPtr = &keys[i];
+		node->left = NULL;
+		node->right = NULL;
+		*link = node;
+		link = &node->right;
+	}
+	tree->count = n;
+	return tree;
+}
+
+// 직접 연결한 사슬에서 측정 (n이 max_depth보다 크면 재귀 쪽은 측정하지 않음)
+static int run_chain( int *keys, long n, long max_depth)
+{
+	TREE *it = make_chain( keys, n);
+	TREE *rec = (n <= max_depth) ? make_chain( keys, n) : NULL;
+	int beyond = (int)n; // 사슬의 끝 다음 키
+	double start, it_ms, rec_ms = -1;
+	long it_sum, rec_sum = 0;
+	int ok = 1;
+
+	sum = 0;
+	start = now_ms();
+	BST_Traverse( it, sum_key);
+	it_ms = now_ms() - start;
+	it_sum = sum;
+	if (rec)
+	{
+		sum = 0;
+		start = now_ms();
+		rec_traverse( rec->root, sum_key);
+		rec_ms = now_ms() - start;
+		rec_sum = sum;
+		if (it_sum != rec_sum) ok = 0;
+	}
+	if (it_sum != (long)n * (n - 1) / 2) ok = 0;
+	print_row( "chain", n, "traverse", it_ms, rec_ms);
+
+	start = now_ms();
+	BST_TraverseR( it, sum_key);
+	it_ms = now_ms() - start;
+	if (rec)
+	{
+		start = now_ms();
+		rec_traverseR( rec->root, sum_key);
+		rec_ms = now_ms() - start;
+	}
+	print_row( "chain", n, "traverseR", it_ms, rec_ms);
+
+	start = now_ms();
+	ok &= (BST_Search( it, &keys[n - 1]) == &keys[n - 1]);
+	it_ms = now_ms() - start;
+	if (rec)
+	{
+		start = now_ms();
+		ok &= (rec_search( rec->root, &keys[n - 1], compare_int) != NULL);
+		rec_ms = now_ms() - start;
+	}
+	print_row( "chain", n, "search_last", it_ms, rec_ms);
+
+	start = now_ms();
+	ok &= (BST_Insert( it, &beyond, no_dup) == 1);
+	it_ms = now_ms() - start;
+	if (rec)
+	{
+		start = now_ms();
+		ok &= (rec_Insert( rec, &beyond) == 1);
+		rec_ms = now_ms() - start;
+	}
+	print_row( "chain", n, "insert_last", it_ms, rec_ms);
+
+	start = now_ms();
+	ok &= (BST_Delete( it, &beyond) == &beyond);
+	it_ms = now_ms() - start;
+	if (rec)
+	{
+		start = now_ms();
+		ok &= (rec_Delete( rec, &beyond) == &beyond);
+		rec_ms = now_ms() - start;
+	}
+	print_row( "chain", n, "delete_last", it_ms, rec_ms);
+	if (BST_Count( it) != n) ok = 0;
+
+	start = now_ms();
+	BST_Destroy( it, NULL);
+	it_ms = now_ms() - start;
+	if (rec)
+	{
+		start = now_ms();
+		rec_destroy( rec->root);
+		free( rec);
+		rec_ms = now_ms() - start;
+	}
+	print_row( "chain", n, "destroy", it_ms, rec_ms);
+
+	return ok;
+}
+
+static void usage( const char *prog)
+{
+	fprintf( stderr, "Usage: %s [-n RANDOM] [-s SORTED] [-c CHAIN] [-r MAX_DEPTH]\n\n", prog);
+	fprintf( stderr, "\t-n RANDOM\tkeys inserted in random order (default 1000000)\n");
+	fprintf( stderr, "\t-s SORTED\tkeys inserted in ascending order (default 20000)\n");
+	fprintf( stderr, "\t-c CHAIN\tnodes of the linked ascending chain (default 10000000)\n");
+	fprintf( stderr, "\t-r MAX_DEPTH\tdeepest chain given to the recursive versions (default 100000)\n");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int main( int argc, char **argv)
+{
+	long nrandom = 1000000, nsorted = 20000, nchain = 10000000, max_depth = 100000;
+	long nmax;
+	int *keys, *shuffled;
+	int opt, ok = 1;
+
+	while ((opt = getopt( argc, argv, "n:s:c:r:")) != -1)
+	{
+		switch (opt)
+		{
+			case 'n': nrandom = atol( optarg); break;
+			case 's': nsorted = atol( optarg); break;
+			case 'c': nchain = atol( optarg); break;
+			case 'r': max_depth = atol( optarg); break;
+			default: usage( argv[0]); return 1;
+		}
+	}
+	if (nrandom < 1 || nsorted < 1 || nchain < 1)
+	{
+		usage( argv[0]);
+		return 1;
+	}
+
+	nmax = nrandom;
+	if (nsorted > nmax) nmax = nsorted;
+	if (nchain > nmax) nmax = nchain;
+
+	keys = (int *)malloc( nmax * sizeof(int));
+	shuffled = (int *)malloc( nrandom * sizeof(int));
+	for (long i = 0; i < nmax; i++) keys[i] = (int)i;
+	for (long i = 0; i < nrandom; i++) shuffled[i] = (int)i;
+	for (long i = nrandom - 1; i > 0; i--)
+	{
+		long j = bench_Rand() % (i + 1);
+		int t = shuffled[i];
+
+		shuffled[i] = shuffled[j];
+		shuffled[j] = t;
+	}
+
+	printf( "shape,nodes,op,iterative_ms,recursive_ms\n");
+	ok &= run_inserted( "random", shuffled, nrandom);
+	ok &= run_inserted( "sorted", keys, nsorted);
+	if (nchain <= max_depth) ok &= run_chain( keys, nchain, max_depth);
+	else
+	{
+		ok &= run_chain( keys, max_depth, max_depth);
+		ok &= run_chain( keys, nchain, max_depth);
+	}
+
+	free( keys);
+	free( shuffled);
+
+	if (!ok)
+	{
+		fprintf( stderr, "iterative and recursive results differ\n");
+		return 1;
+	}
+	return 0;
+}
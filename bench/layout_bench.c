@@ -0,0 +1,227 @@
+#include <stdio.h>
+#include <stdlib.h> // malloc, realloc, free, atoi
+#include <string.h> // strcmp, strdup
+#include <unistd.h> // getopt
+#include <time.h> // clock_gettime
+#include <malloc.h> // mallinfo2
+
+#include "adt_dlist.h"
+#include "adt_ilist.h"
+#include "tokenizer.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// 리스트 노드 배치 비교
+//	dlist		adt_dlist (createList): 원소마다 NODE와 tWord를 따로 할당, dataPtr로 연결
+//	dlist_pool	adt_dlist (createListPooled): NODE는 slab에서, tWord는 따로 할당
+//	ilist		adt_ilist: tWord 안에 ILINK를 넣어 원소마다 한 번 할당
+// 단어 파일의 단어로 사전을 만든 뒤, 원소당 힙 사용량(malloc chunk 포함)과 순회 시간을 측정
+// 단어 문자열은 측정 전에 모두 읽어 두고 공유하므로 측정에 포함되지 않음
+//
+// layout,words,bytes_per_word,build_ms,forward_ms,backward_ms
+
+// adt_dlist의 데이터
+typedef struct {
+	char	*word;
+	int		freq;
+} tWord;
+
+// adt_ilist의 원소
+typedef struct {
+	char	*word;
+	int		freq;
+	ILINK	link;	// list hook
+} tIWord;
+
+static long sum; // 순회 결과 (최적화로 없어지지 않도록)
+
+// 입력 파일의 단어들 (등장 순서)
+static char **tokens;
+static long ntokens;
+
+static int compare_word( const void *n1, const void *n2)
+{
+	return strcmp( ((const tWord *)n1)->word, ((const tWord *)n2)->word);
+}
+
+static void increase_freq( const void *dataPtr)
+{
+	((tWord *)dataPtr)->freq++;
+}
+
+static void sum_freq( const void *dataPtr)
+{
+	sum += ((const tWord *)dataPtr)->freq;
+}
+
+static int compare_iword( const ILINK *n1, const ILINK *n2)
+{
+	return strcmp( ilist_Entry( n1, const tIWord, link)->word, ilist_Entry( n2, const tIWord, link)->word);
+}
+
+static void increase_ifreq( ILINK *link)
+{
+	ilist_Entry( link, tIWord, link)->freq++;
+}
+
+static void sum_ifreq( const ILINK *link)
+{
+	sum += ilist_Entry( link, const tIWord, link)->freq;
+}
+
+static void free_iword( ILINK *link)
+{
+	free( ilist_Entry( link, tIWord, link));
+}
+
+static double now_ms( void)
+{
+	struct timespec ts;
+
+	clock_gettime( CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+// 현재 사용 중인 힙 크기 (malloc chunk header 포함)
+static size_t heap_used( void)
+{
+	return mallinfo2().uordblks;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// adt_dlist로 측정
+static void run_dlist( const char *name, int pooled, int passes)
+{
+	size_t before = heap_used();
+	LIST *list = pooled ? createListPooled( compare_word) : createList( compare_word);
+	double start, build_ms, fwd_ms, bwd_ms;
+	size_t bytes;
+
+	start = now_ms();
+	for (long i = 0; i < ntokens; i++)
+	{
+		tWord *pWord = (tWord *)malloc( sizeof(tWord));
+
+		pWord->word = tokens[i];
+		pWord->freq = 1;
+		if (addNode( list, pWord, increase_freq) != 1) free( pWord);
+	}
+	build_ms = now_ms() - start;
+	bytes = heap_used() - before;
+
+	start = now_ms();
+	for (int i = 0; i < passes; i++) traverseList( list, sum_freq);
+	fwd_ms = (now_ms() - start) / passes;
+
+	start = now_ms();
+	for (int i = 0; i < passes; i++) traverseListR( list, sum_freq);
+	bwd_ms = (now_ms() - start) / passes;
+
+	printf( "%s,%d,%.1f,%.3f,%.4f,%.4f\n", name, countList( list), (double)bytes / countList( list), build_ms, fwd_ms, bwd_ms);
+
+	destroyList( list, free);
+}
+
+// adt_ilist로 측정
+static void run_ilist( int passes)
+{
+	size_t before = heap_used();
+	ILIST *list = ilist_Create( compare_iword);
+	double start, build_ms, fwd_ms, bwd_ms;
+	size_t bytes;
+
+	start = now_ms();
+	for (long i = 0; i < ntokens; i++)
+	{
+		tIWord *pWord = (tIWord *)malloc( sizeof(tIWord));
+
+		pWord->word = tokens[i];
+		pWord->freq = 1;
+		if (ilist_Add( list, &pWord->link, increase_ifreq) != 1) free( pWord);
+	}
+	build_ms = now_ms() - start;
+	bytes = heap_used() - before;
+
+	start = now_ms();
+	for (int i = 0; i < passes; i++) ilist_Traverse( list, sum_ifreq);
+	fwd_ms = (now_ms() - start) / passes;
+
+	start = now_ms();
+	for (int i = 0; i < passes; i++) ilist_TraverseR( list, sum_ifreq);
+	bwd_ms = (now_ms() - start) / passes;
+
+	printf( "ilist,%d,%.1f,%.3f,%.4f,%.4f\n", ilist_Count( list), (double)bytes / ilist_Count( list), build_ms, fwd_ms, bwd_ms);
+
+	ilist_Destroy( list, free_iword);
+}
+
+// 입력 파일의 모든 단어를 tokens에 복사
+// return	1 if successful
+//			0 if the file cannot be opened
+static int load_tokens( const char *filename)
+{
+	TOKENIZER *tok = tok_Open( filename, TOK_CSTR);
+	tToken token;
+	long cap = 1024;
+
+	if (tok == NULL) return 0;
+
+	tokens = (char **)malloc( cap * sizeof(char *));
+	while (tok_Next( tok, &token))
+	{
+		if (ntokens == cap)
+		{
+			cap *= 2;
+			tokens = (char **)realloc( tokens, cap * sizeof(char *));
+		}
+		tokens[ntokens++] = strdup( token.ptr);
+	}
+	tok_Close( tok);
+	return 1;
+}
+
+static void usage( const char *prog)
+{
+	fprintf( stderr, "Usage: %s [-p PASSES] [FILE]\n\n", prog);
+	fprintf( stderr, "\t-p PASSES\tnumber of traversals to average (default 1000)\n");
+	fprintf( stderr, "\tFILE\t\tword file (default ../assignment05/words.txt)\n");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int main( int argc, char **argv)
+{
+	const char *filename = "../assignment05/words.txt";
+	int passes = 1000;
+	int opt;
+
+	while ((opt = getopt( argc, argv, "p:")) != -1)
+	{
+		switch (opt)
+		{
+			case 'p': passes = atoi( optarg); break;
+			default: usage( argv[0]); return 1;
+		}
+	}
+	if (optind < argc) filename = argv[optind];
+	if (passes < 1)
+	{
+		usage( argv[0]);
+		return 1;
+	}
+
+	if (!load_tokens( filename))
+	{
+		fprintf( stderr, "cannot open file : %s\n", filename);
+		return 1;
+	}
+
+	printf( "layout,words,bytes_per_word,build_ms,forward_ms,backward_ms\n");
+	if (ntokens == 0) return 0;
+
+	run_dlist( "dlist", 0, passes);
+	run_dlist( "dlist_pool", 1, passes);
+	run_ilist( passes);
+
+	for (long i = 0; i < ntokens; i++) free( tokens[i]);
+	free( tokens);
+	return 0;
+}
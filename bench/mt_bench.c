@@ -0,0 +1,247 @@
+#include <stdio.h>
+#include <stdlib.h> // malloc, free, atoi, strtod
+#include <string.h> // strcmp, strdup
+#include <unistd.h> // getopt
+#include <time.h> // clock_gettime, nanosleep
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "adt_clist.h"
+#include "tokenizer.h"
+#include "bench_util.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// adt_clist의 다중 thread 처리량 측정
+// 단어 파일로 사전을 만든 뒤, reader thread들은 사전의 단어를 무작위로 골라 searchNode를 반복하고
+// writer thread들은 무작위 단어를 removeNode한 뒤 같은 데이터를 다시 addNode
+// writer가 둘 이상이면 removeNode가 동시에 grace period를 기다리는 경우도 시험함
+// (reader는 찾은 데이터가 찾던 단어인지 확인하여, 해제된 노드를 따라간 흔적이 있으면 보고)
+//	lockfree	adt_clist 그대로 (reader는 lock 없이 탐색)
+//	rwlock		같은 리스트의 호출을 pthread_rwlock으로 감쌈 (reader는 read lock, writer는 write lock)
+// writer 0, 1, 2개 각각에 대해 reader 수를 1, 2, 4, ... 로 늘리며 측정
+//
+// mode,readers,writers,seconds,lookups_per_sec,writes_per_sec
+
+typedef struct {
+	char	*word;
+	atomic_int	freq; // writer의 increase_freq와 reader가 동시에 읽을 수 있음
+} tWord;
+
+enum { MODE_LOCKFREE, MODE_RWLOCK };
+static const char *mode_names[] = { "lockfree", "rwlock" };
+
+static LIST *list;
+static pthread_rwlock_t rwlock = PTHREAD_RWLOCK_INITIALIZER;
+static int mode;
+static atomic_int stop;
+
+// 사전의 단어 (traverseList callback으로 모음)
+static tWord **vocab;
+static int nvocab;
+
+static int compare_by_word( const void *n1, const void *n2)
+{
+	return strcmp( ((const tWord *)n1)->word, ((const tWord *)n2)->word);
+}
+
+static void increase_freq( const void *dataPtr)
+{
+	atomic_fetch_add_explicit( &((tWord *)dataPtr)->freq, 1, memory_order_relaxed);
+}
+
+static void destroy_word( void *dataPtr)
+{
+	free( ((tWord *)dataPtr)->word);
+	free( dataPtr);
+}
+
+static void collect_word( const void *dataPtr)
+{
+	vocab[nvocab++] = (tWord *)dataPtr;
+}
+
+static double now_sec( void)
+{
+	struct timespec ts;
+
+	clock_gettime( CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+typedef struct {
+	pthread_t			tid;
+	unsigned long long	seed;
+	long				ops;	// 수행한 연산 수
+	long				found;	// reader: 찾은 단어 수
+	long				wrong;	// reader: 찾은 데이터가 찾던 단어가 아닌 경우
+} tWorker;
+
+static void *reader_main( void *arg)
+{
+	tWorker *w = (tWorker *)arg;
+	tWord key;
+	void *dataOut;
+
+	while (!atomic_load_explicit( &stop, memory_order_relaxed))
+	{
+		int token = 0;
+
+		key.word = vocab[bench_RandR( &w->seed) % nvocab]->word;
+
+		if (mode == MODE_RWLOCK) pthread_rwlock_rdlock( &rwlock);
+		if (mode == MODE_LOCKFREE) token = readLockList( list); // dataOut을 읽는 동안 노드가 해제되지 않도록
+		if (searchNode( list, &key, &dataOut))
+		{
+			w->found++;
+			if (strcmp( ((tWord *)dataOut)->word, key.word) != 0) w->wrong++;
+		}
+		if (mode == MODE_LOCKFREE) readUnlockList( list, token);
+		if (mode == MODE_RWLOCK) pthread_rwlock_unlock( &rwlock);
+
+		w->ops++;
+	}
+	return NULL;
+}
+
+// 지운 단어는 바로 다시 넣으므로 사전의 단어 수는 거의 일정
+static void *writer_main( void *arg)
+{
+	tWorker *w = (tWorker *)arg;
+	tWord key;
+	void *dataOut;
+
+	while (!atomic_load_explicit( &stop, memory_order_relaxed))
+	{
+		key.word = vocab[bench_RandR( &w->seed) % nvocab]->word;
+
+		if (mode == MODE_RWLOCK) pthread_rwlock_wrlock( &rwlock);
+		if (removeNode( list, &key, &dataOut)) addNode( list, dataOut, increase_freq);
+		if (mode == MODE_RWLOCK) pthread_rwlock_unlock( &rwlock);
+
+		w->ops += 2;
+	}
+	return NULL;
+}
+
+// readers개의 reader와 writers개의 writer를 seconds초 동안 실행
+static void run( int readers, int writers, double seconds)
+{
+	tWorker *workers = (tWorker *)calloc( readers + writers, sizeof(tWorker));
+	struct timespec ts = { (time_t)seconds, (long)((seconds - (time_t)seconds) * 1e9) };
+	long lookups = 0, writes = 0, found = 0, wrong = 0;
+	double start, elapsed;
+
+	atomic_store( &stop, 0);
+	start = now_sec();
+	for (int i = 0; i < readers + writers; i++)
+	{
+		workers[i].seed = 88172645463325252ULL + i * 0x9E3779B97F4A7C15ULL;
+		if (i < readers) pthread_create( &workers[i].tid, NULL, reader_main, &workers[i]);
+		else pthread_create( &workers[i].tid, NULL, writer_main, &workers[i]);
+	}
+
+	nanosleep( &ts, NULL);
+	atomic_store( &stop, 1);
+
+	for (int i = 0; i < readers + writers; i++)
+	{
+		pthread_join( workers[i].tid, NULL);
+		if (i < readers)
+		{
+			lookups += workers[i].ops;
+			found += workers[i].found;
+			wrong += workers[i].wrong;
+		}
+		else writes += workers[i].ops;
+	}
+	elapsed = now_sec() - start;
+
+	// writer가 없으면 모든 질의가 성공해야 하며, 찾은 데이터는 항상 찾던 단어여야 함
+	if (!writers && found != lookups) fprintf( stderr, "%s: %ld of %ld lookups failed\n", mode_names[mode], lookups - found, lookups);
+	if (wrong) fprintf( stderr, "%s: %ld of %ld lookups returned a wrong word\n", mode_names[mode], wrong, found);
+
+	printf( "%s,%d,%d,%.2f,%.0f,%.0f\n", mode_names[mode], readers, writers, elapsed, lookups / elapsed, writes / elapsed);
+	fflush( stdout);
+	free( workers);
+}
+
+// 입력 파일의 단어로 사전을 만들고 vocab에 모음
+// return	1 if successful
+//			0 if the file cannot be opened
+static int build( const char *filename)
+{
+	TOKENIZER *tok = tok_Open( filename, TOK_CSTR);
+	tToken token;
+
+	if (tok == NULL) return 0;
+
+	list = createList( compare_by_word);
+	while (tok_Next( tok, &token))
+	{
+		tWord *pWord = (tWord *)malloc( sizeof(tWord));
+
+		pWord->word = strdup( token.ptr);
+		atomic_init( &pWord->freq, 1);
+		if (addNode( list, pWord, increase_freq) != 1) destroy_word( pWord);
+	}
+	tok_Close( tok);
+
+	vocab = (tWord **)malloc( countList( list) * sizeof(tWord *));
+	traverseList( list, collect_word);
+	return 1;
+}
+
+static void usage( const char *prog)
+{
+	fprintf( stderr, "Usage: %s [-r MAX_READERS] [-t SECONDS] [-w WRITERS] [FILE]\n\n", prog);
+	fprintf( stderr, "\t-r MAX_READERS\treader threads 1, 2, 4, ... up to MAX_READERS (default 4)\n");
+	fprintf( stderr, "\t-t SECONDS\tduration of each run (default 1)\n");
+	fprintf( stderr, "\t-w WRITERS\tnumber of writer threads (default: 0, 1 and 2)\n");
+	fprintf( stderr, "\tFILE\t\tword file (default ../assignment05/words.txt)\n");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int main( int argc, char **argv)
+{
+	const char *filename = "../assignment05/words.txt";
+	int max_readers = 4;
+	double seconds = 1.0;
+	int writers_from = 0, writers_to = 2;
+	int opt;
+
+	while ((opt = getopt( argc, argv, "r:t:w:")) != -1)
+	{
+		switch (opt)
+		{
+			case 'r': max_readers = atoi( optarg); break;
+			case 't': seconds = strtod( optarg, NULL); break;
+			case 'w': writers_from = writers_to = atoi( optarg); break;
+			default: usage( argv[0]); return 1;
+		}
+	}
+	if (optind < argc) filename = argv[optind];
+	if (max_readers < 1 || seconds <= 0 || writers_from < 0)
+	{
+		usage( argv[0]);
+		return 1;
+	}
+
+	if (!build( filename))
+	{
+		fprintf( stderr, "cannot open file : %s\n", filename);
+		return 1;
+	}
+
+	printf( "mode,readers,writers,seconds,lookups_per_sec,writes_per_sec\n");
+	if (nvocab == 0) return 0;
+
+	for (int writers = writers_from; writers <= writers_to; writers++)
+		for (mode = MODE_LOCKFREE; mode <= MODE_RWLOCK; mode++)
+			for (int readers = 1; readers <= max_readers; readers *= 2)
+				run( readers, writers, seconds);
+
+	destroyList( list, destroy_word);
+	free( vocab);
+	return 0;
+}
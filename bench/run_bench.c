@@ -0,0 +1,423 @@
+#include <stdio.h>
+#include <stdlib.h> // malloc, free, qsort, atoi, strtod
+#include <string.h> // strcmp, strchr, strdup
+#include <signal.h> // SIGALRM
+#include <unistd.h> // unlink, rmdir, getopt
+#include <sys/wait.h> // WIFSIGNALED, WIFEXITED
+#include <sys/resource.h> // struct rusage
+#include <time.h> // clock_gettime
+
+#include "bench_util.h"
+
+#define MAX_WORD_LEN	16		// 생성하는 단어의 최대 길이
+#define MAX_STDERR		(64 * 1024)	// backend의 표준 에러에서 읽는 최대 크기
+
+// backend 정의
+typedef struct {
+	const char	*name;		// 결과 표에 표시할 이름
+	const char	*program;	// bench 디렉토리에 빌드된 실행 파일
+	int			interactive;	// 1: 메뉴 방식 (표준 입력으로 "P\nQ\n"), 0: "-n FILE"
+	const char	*option;	// 메뉴 방식에서 입력 파일 앞에 붙이는 옵션 (NULL이면 없음)
+} tBackend;
+
+static const tBackend backends[] = {
+	{ "array",	"word_count1", 0, NULL },	// 배열 + 해시 인덱스
+	{ "sorted",	"word_count2", 0, NULL },	// 정렬된 블록 배열
+	{ "slist",	"word_count3", 0, NULL },	// 단일 연결 리스트
+	{ "dlist",	"word_count4", 1, NULL },	// 이중 연결 리스트 (word_count4)
+	{ "adt_dlist",	"word_count5", 1, NULL },	// 이중 연결 리스트 (adt_dlist)
+	{ "skiplist",	"word_count5_skiplist", 1, NULL },	// skip list (word_count5, -DUSE_SKIPLIST)
+	{ "unrolled",	"word_count5_unrolled", 1, NULL },	// unrolled linked list (word_count5, -DUSE_UNROLLED)
+	// 트리는 단어마다 삽입하여 사전을 만듦 (--insert, 다른 backend와 같이 build가 삽입 비용을 잼)
+	{ "bst",	"word_count6", 1, "--insert" },	// 이진 탐색 트리
+	{ "splay",	"word_count6_splay", 1, "--insert" },	// splay tree (word_count6, splay.c)
+	{ "avlt",	"word_count7", 1, "--insert" },	// AVL 트리
+	// 기본 빌드: counting pass(해시로 빈도를 센 뒤 wsort_ByWord)와 *_BuildSorted
+	// build_ms는 트리 삽입이 아닌 이 과정의 시간이며, 트리 비교를 하지 않으므로 cmp_per_insert는 0
+	{ "bst_count",	"word_count6", 1, NULL },
+	{ "avlt_count",	"word_count7", 1, NULL },
+};
+#define NUM_BACKENDS	(int)(sizeof(backends) / sizeof(backends[0]))
+
+// workload 정의
+#define WL_SHUFFLED		0	// 모든 단어가 같은 빈도, 무작위 순서
+#define WL_SORTED		1	// WL_SHUFFLED와 같은 단어들을 정렬한 순서
+#define WL_ZIPF			2	// Zipf 분포 (s = 1)
+#define WL_ORDERED		3	// assignment08/words_ordered.txt
+#define WL_FREQ			4	// assignment07/word_freq_shuffle.txt의 빈도대로 펼친 뒤 섞음
+
+static const char *workload_names[] = { "shuffled", "sorted", "zipf", "words_ordered", "word_freq_shuffle" };
+#define NUM_WORKLOADS	5
+
+// 측정 결과
+typedef struct {
+	int		ok;			// 1: 성공, 0: 실패 또는 시간 초과
+	int		timeout;
+	double	wall_ms;
+	long	maxrss_kb;
+	double	build_ms, lookup_ms, dump_ms;
+	long	build_ops, lookup_ops, dump_ops;
+	unsigned long long build_cmp, lookup_cmp;
+	int		words;
+} tResult;
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+// 무작위 단어 nvocab개 생성 (길이 3 ~ MAX_WORD_LEN - 1, 소문자)
+static char **make_vocab( int nvocab)
+{
+	char **vocab = (char **)malloc( nvocab * sizeof(char *));
+
+	for (int i = 0; i < nvocab; i++)
+	{
+		int len = 3 + bench_Rand() % (MAX_WORD_LEN - 3);
+
+		vocab[i] = (char *)malloc( len + 1);
+		for (int j = 0; j < len; j++) vocab[i][j] = 'a' + bench_Rand() % 26;
+		vocab[i][len] = '\0';
+	}
+	return vocab;
+}
+
+static int compare_str( const void *p1, const void *p2)
+{
+	return strcmp( *(char * const *)p1, *(char * const *)p2);
+}
+
+static void shuffle( char **tokens, long n)
+{
+	for (long i = n - 1; i > 0; i--)
+	{
+		long j = bench_Rand() % (i + 1);
+		char *t = tokens[i];
+
+		tokens[i] = tokens[j];
+		tokens[j] = t;
+	}
+}
+
+// 토큰들을 한 줄에 하나씩 파일에 저장
+// return	1 if successful
+//			0 if the file cannot be created
+static int write_tokens( const char *path, char **tokens, long n)
+{
+	FILE *fp = fopen( path, "w");
+
+	if (fp == NULL) return 0;
+
+	for (long i = 0; i < n; i++)
+	{
+		fputs( tokens[i], fp);
+		fputc( '\n', fp);
+	}
+	fclose( fp);
+	return 1;
+}
+
+// word_freq_shuffle.txt의 각 단어를 빈도만큼 펼친 뒤 섞어서 저장
+// return	1 if successful
+//			0 if a file cannot be opened
+static int write_freq_workload( const char *src, const char *path)
+{
+	FILE *fp = fopen( src, "r");
+	char word[100];
+	int freq;
+	long n = 0, cap = 1024;
+	char **tokens;
+	int ok;
+
+	if (fp == NULL) return 0;
+
+	tokens = (char **)malloc( cap * sizeof(char *));
+	while (fscanf( fp, "%99s%d", word, &freq) == 2)
+	{
+		char *w = strdup( word);
+
+		for (int i = 0; i < freq; i++)
+		{
+			if (n == cap)
+			{
+				cap *= 2;
+				tokens = (char **)realloc( tokens, cap * sizeof(char *));
+			}
+			tokens[n++] = w;
+		}
+	}
+	fclose( fp);
+
+	shuffle( tokens, n);
+	ok = write_tokens( path, tokens, n);
+
+	// 같은 단어는 같은 포인터이므로 정렬한 뒤 한 번씩 해제
+	qsort( tokens, n, sizeof(char *), compare_str);
+	for (long i = 0; i < n; i++)
+		if (i == 0 || tokens[i] != tokens[i - 1]) free( tokens[i]);
+	free( tokens);
+
+	return ok;
+}
+
+// 생성하는 workload 파일들을 dir에 저장
+// return	1 if successful
+//			0 if a file cannot be created
+static int make_workloads( const char *dir, const char *srcdir, long ntokens, int nvocab, char paths[][512])
+{
+	char **vocab = make_vocab( nvocab);
+	char **tokens = (char **)malloc( ntokens * sizeof(char *));
+	double *cdf = (double *)malloc( nvocab * sizeof(double));
+	double sum = 0;
+	int ok = 1;
+
+	for (int w = 0; w < NUM_WORKLOADS; w++)
+		snprintf( paths[w], 512, "%s/%s.txt", dir, workload_names[w]);
+
+	// shuffled, sorted: 모든 단어가 (거의) 같은 빈도
+	for (long i = 0; i < ntokens; i++) tokens[i] = vocab[i % nvocab];
+	shuffle( tokens, ntokens);
+	ok &= write_tokens( paths[WL_SHUFFLED], tokens, ntokens);
+
+	qsort( tokens, ntokens, sizeof(char *), compare_str);
+	ok &= write_tokens( paths[WL_SORTED], tokens, ntokens);
+
+	// zipf: k번째 단어의 확률이 1/k에 비례
+	for (int k = 0; k < nvocab; k++)
+	{
+		sum += 1.0 / (k + 1);
+		cdf[k] = sum;
+	}
+	for (long i = 0; i < ntokens; i++)
+	{
+		double u = bench_RandDouble() * sum;
+		int lo = 0, hi = nvocab - 1;
+
+		while (lo < hi)
+		{
+			int mid = (lo + hi) / 2;
+
+			if (cdf[mid] < u) lo = mid + 1;
+			else hi = mid;
+		}
+		tokens[i] = vocab[lo];
+	}
+	ok &= write_tokens( paths[WL_ZIPF], tokens, ntokens);
+
+	// 저장소에 있는 입력 파일
+	snprintf( paths[WL_ORDERED], 512, "%s/assignment08/words_ordered.txt", srcdir);
+	{
+		char src[512];
+
+		snprintf( src, sizeof(src), "%s/assignment07/word_freq_shuffle.txt", srcdir);
+		ok &= write_freq_workload( src, paths[WL_FREQ]);
+	}
+
+	for (int i = 0; i < nvocab; i++) free( vocab[i]);
+	free( vocab);
+	free( tokens);
+	free( cdf);
+
+	return ok;
+}
+
+// 생성한 workload 파일과 디렉토리를 삭제
+static void remove_workloads( const char *dir, char paths[][512])
+{
+	for (int w = 0; w < NUM_WORKLOADS; w++)
+		if (w != WL_ORDERED) unlink( paths[w]);
+	rmdir( dir);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// backend의 "stats ..." 줄을 읽어 result에 저장
+static int parse_stats( const char *text, tResult *r)
+{
+	const char *line = strstr( text, "stats build_ms=");
+
+	if (line == NULL) return 0;
+
+	return sscanf( line,
+		"stats build_ms=%lf build_ops=%ld build_cmp=%llu lookup_ms=%lf lookup_ops=%ld lookup_cmp=%llu dump_ms=%lf dump_ops=%ld words=%d",
+		&r->build_ms, &r->build_ops, &r->build_cmp, &r->lookup_ms, &r->lookup_ops, &r->lookup_cmp,
+		&r->dump_ms, &r->dump_ops, &r->words) == 9;
+}
+
+static double now_ms( void)
+{
+	struct timespec ts;
+
+	clock_gettime( CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+// backend를 한 번 실행하여 측정
+// 표준 출력은 /dev/null로 보내고, 표준 에러에서 측정 결과를 읽음
+static tResult run_backend( const char *bindir, const tBackend *b, const char *input, int timeout)
+{
+	tResult r;
+	char program[512];
+	char *text = (char *)malloc( MAX_STDERR);
+	char *argv[4] = { program, NULL, NULL, NULL };
+	struct rusage ru;
+	int status;
+	double start;
+
+	memset( &r, 0, sizeof(r));
+	if (text == NULL) return r;
+	snprintf( program, sizeof(program), "%s/%s", bindir, b->program);
+
+	if (b->interactive && b->option)
+	{
+		argv[1] = (char *)b->option;
+		argv[2] = (char *)input;
+	}
+	else if (b->interactive) argv[1] = (char *)input;
+	else
+	{
+		argv[1] = "-n";
+		argv[2] = (char *)input;
+	}
+
+	// 메뉴 방식: 전체 출력(P) 후 종료(Q)
+	start = now_ms();
+	status = bench_Run( argv, b->interactive ? "P\nQ\n" : NULL, NULL, timeout, text, MAX_STDERR, &ru);
+	r.wall_ms = now_ms() - start;
+	if (status < 0)
+	{
+		free( text);
+		return r;
+	}
+	r.maxrss_kb = ru.ru_maxrss;
+
+	if (WIFSIGNALED( status) && WTERMSIG( status) == SIGALRM) r.timeout = 1;
+	else if (WIFEXITED( status) && WEXITSTATUS( status) == 0) r.ok = parse_stats( text, &r);
+
+	free( text);
+	return r;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+static void print_header( int json)
+{
+	if (json) printf( "[\n");
+	else printf( "backend,workload,tokens,words,build_ms,lookup_ms,lookups_per_sec,peak_rss_kb,cmp_per_insert,cmp_per_lookup,dump_ms,wall_ms,status\n");
+}
+
+static void print_result( int json, int first, const char *backend, const char *workload, const tResult *r)
+{
+	const char *status = r->ok ? "ok" : (r->timeout ? "timeout" : "error");
+	double lps = (r->ok && r->lookup_ms > 0) ? r->lookup_ops / (r->lookup_ms / 1e3) : 0;
+	double cpi = (r->ok && r->build_ops > 0) ? (double)r->build_cmp / r->build_ops : 0;
+	double cpl = (r->ok && r->lookup_ops > 0) ? (double)r->lookup_cmp / r->lookup_ops : 0;
+
+	if (json)
+	{
+		printf( "%s  {\"backend\": \"%s\", \"workload\": \"%s\", \"tokens\": %ld, \"words\": %d, "
+			"\"build_ms\": %.3f, \"lookup_ms\": %.3f, \"lookups_per_sec\": %.0f, \"peak_rss_kb\": %ld, "
+			"\"cmp_per_insert\": %.2f, \"cmp_per_lookup\": %.2f, \"dump_ms\": %.3f, \"wall_ms\": %.3f, \"status\": \"%s\"}",
+			first ? "" : ",\n", backend, workload, r->build_ops, r->words,
+			r->build_ms, r->lookup_ms, lps, r->maxrss_kb, cpi, cpl, r->dump_ms, r->wall_ms, status);
+	}
+	else
+	{
+		printf( "%s,%s,%ld,%d,%.3f,%.3f,%.0f,%ld,%.2f,%.2f,%.3f,%.3f,%s\n",
+			backend, workload, r->build_ops, r->words,
+			r->build_ms, r->lookup_ms, lps, r->maxrss_kb, cpi, cpl, r->dump_ms, r->wall_ms, status);
+	}
+	fflush( stdout);
+}
+
+// 쉼표로 구분된 목록에 name이 있는지 확인 (list가 NULL이면 모두 선택)
+static int selected( const char *list, const char *name)
+{
+	size_t len = strlen( name);
+
+	if (list == NULL) return 1;
+
+	for (const char *p = list; p != NULL; p = strchr( p, ','))
+	{
+		if (*p == ',') p++;
+		if (strncmp( p, name, len) == 0 && (p[len] == ',' || p[len] == '\0')) return 1;
+	}
+	return 0;
+}
+
+static void usage( const char *prog)
+{
+	fprintf( stderr, "Usage: %s [-n TOKENS] [-v VOCAB] [-t SECONDS] [-b BACKENDS] [-w WORKLOADS] [-s SRCDIR] [-d BINDIR] [-j]\n\n", prog);
+	fprintf( stderr, "\t-n TOKENS\tnumber of tokens in generated workloads (default 50000)\n");
+	fprintf( stderr, "\t-v VOCAB\tnumber of distinct words in generated workloads (default 5000)\n");
+	fprintf( stderr, "\t-t SECONDS\ttime limit per run (default 120)\n");
+	fprintf( stderr, "\t-b BACKENDS\tcomma separated: array,sorted,slist,dlist,adt_dlist,skiplist,unrolled,bst,splay,avlt,bst_count,avlt_count\n");
+	fprintf( stderr, "\t-w WORKLOADS\tcomma separated: shuffled,sorted,zipf,words_ordered,word_freq_shuffle\n");
+	fprintf( stderr, "\t-s SRCDIR\trepository root (default ..)\n");
+	fprintf( stderr, "\t-d BINDIR\tdirectory of the instrumented backends (default .)\n");
+	fprintf( stderr, "\t-j\t\tJSON output (default CSV)\n");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int main( int argc, char **argv)
+{
+	long ntokens = 50000;
+	int nvocab = 5000;
+	int timeout = 120;
+	int json = 0;
+	const char *blist = NULL, *wlist = NULL;
+	const char *srcdir = "..", *bindir = ".";
+	char dir[] = "/tmp/wc_bench.XXXXXX";
+	char paths[NUM_WORKLOADS][512];
+	int opt, first = 1;
+
+	while ((opt = getopt( argc, argv, "n:v:t:b:w:s:d:j")) != -1)
+	{
+		switch (opt)
+		{
+			case 'n': ntokens = atol( optarg); break;
+			case 'v': nvocab = atoi( optarg); break;
+			case 't': timeout = atoi( optarg); break;
+			case 'b': blist = optarg; break;
+			case 'w': wlist = optarg; break;
+			case 's': srcdir = optarg; break;
+			case 'd': bindir = optarg; break;
+			case 'j': json = 1; break;
+			default: usage( argv[0]); return 1;
+		}
+	}
+	if (ntokens < 1 || nvocab < 1 || timeout < 1)
+	{
+		usage( argv[0]);
+		return 1;
+	}
+
+	if (mkdtemp( dir) == NULL)
+	{
+		fprintf( stderr, "cannot create directory %s\n", dir);
+		return 2;
+	}
+	if (!make_workloads( dir, srcdir, ntokens, nvocab, paths))
+	{
+		fprintf( stderr, "cannot create workloads in %s (source directory: %s)\n", dir, srcdir);
+		remove_workloads( dir, paths);
+		return 2;
+	}
+
+	print_header( json);
+	for (int w = 0; w < NUM_WORKLOADS; w++)
+	{
+		if (!selected( wlist, workload_names[w])) continue;
+
+		for (int i = 0; i < NUM_BACKENDS; i++)
+		{
+			tResult r;
+
+			if (!selected( blist, backends[i].name)) continue;
+
+			r = run_backend( bindir, &backends[i], paths[w], timeout);
+			print_result( json, first, backends[i].name, workload_names[w], &r);
+			first = 0;
+		}
+	}
+	if (json) printf( "\n]\n");
+
+	remove_workloads( dir, paths);
+
+	return 0;
+}
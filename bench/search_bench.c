@@ -0,0 +1,219 @@
+#include <stdio.h>
+#include <stdlib.h> // malloc, free, atoi, strtod
+#include <string.h> // strcmp
+#include <unistd.h> // getopt
+#include <time.h> // clock_gettime
+#include <math.h> // pow
+
+#include "adt_dlist.h"
+#include "tokenizer.h"
+#include "bench_util.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// adt_dlist의 탐색 방식(list mode) 비교
+// 단어 파일로 사전을 만든 뒤, 사전의 단어를 Zipf 분포로 고른 질의(searchNode)를 모든 mode에 똑같이 실행
+// 질의 순위는 단어순과 무관하도록 무작위로 섞은 단어에 매김
+//
+// mode,words,build_ms,cmp_per_insert,queries,query_ms,cmp_per_query,found
+
+typedef struct {
+	char	*word;
+	int		freq;
+} tWord;
+
+static const struct {
+	const char	*name;
+	int			mode;
+} modes[] = {
+	{ "sorted",		LIST_SORTED },
+	{ "finger",		LIST_FINGER },
+	{ "mtf",		LIST_MTF },
+	{ "transpose",	LIST_TRANSPOSE },
+};
+#define NUM_MODES	(int)(sizeof(modes) / sizeof(modes[0]))
+
+static unsigned long long ncmp; // 단어 비교 횟수
+
+static int compare_by_word( const void *n1, const void *n2)
+{
+	ncmp++;
+	return strcmp( ((const tWord *)n1)->word, ((const tWord *)n2)->word);
+}
+
+static void increase_freq( const void *dataPtr)
+{
+	((tWord *)dataPtr)->freq++;
+}
+
+static void destroy_word( void *dataPtr)
+{
+	free( ((tWord *)dataPtr)->word);
+	free( dataPtr);
+}
+
+// 사전의 단어를 vocab에 모음 (traverseList callback)
+static tWord **vocab;
+static int nvocab;
+
+static void collect_word( const void *dataPtr)
+{
+	vocab[nvocab++] = (tWord *)dataPtr;
+}
+
+static double now_ms( void)
+{
+	struct timespec ts;
+
+	clock_gettime( CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+// 단어 파일의 모든 단어로 사전을 만듦
+// return	list pointer
+//			NULL if the file cannot be opened
+static LIST *build_list( const char *filename, int mode, double *ms, unsigned long long *cmp, long *ntokens)
+{
+	TOKENIZER *tok = tok_Open( filename, TOK_CSTR);
+	LIST *list = createListMode( compare_by_word, mode);
+	tToken token;
+	double start;
+
+	if (tok == NULL || list == NULL)
+	{
+		if (tok) tok_Close( tok);
+		if (list) destroyList( list, destroy_word);
+		return NULL;
+	}
+
+	*ntokens = 0;
+	ncmp = 0;
+	start = now_ms();
+	while (tok_Next( tok, &token))
+	{
+		tWord *pWord = (tWord *)malloc( sizeof(tWord));
+
+		pWord->word = strdup( token.ptr);
+		pWord->freq = 1;
+		if (addNode( list, pWord, increase_freq) != 1) destroy_word( pWord);
+		(*ntokens)++;
+	}
+	*ms = now_ms() - start;
+	*cmp = ncmp;
+
+	tok_Close( tok);
+	return list;
+}
+
+static void usage( const char *prog)
+{
+	fprintf( stderr, "Usage: %s [-q QUERIES] [-z SKEW] [FILE]\n\n", prog);
+	fprintf( stderr, "\t-q QUERIES\tnumber of searches (default 50000)\n");
+	fprintf( stderr, "\t-z SKEW\t\tZipf exponent s, rank k has probability 1/k^s (default 1.0)\n");
+	fprintf( stderr, "\tFILE\t\tword file (default ../assignment05/words.txt)\n");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int main( int argc, char **argv)
+{
+	const char *filename = "../assignment05/words.txt";
+	long nqueries = 50000;
+	double skew = 1.0;
+	tWord **queries;
+	double *cdf, sum = 0;
+	LIST *list;
+	double ms;
+	unsigned long long cmp;
+	long ntokens;
+	int opt;
+
+	while ((opt = getopt( argc, argv, "q:z:")) != -1)
+	{
+		switch (opt)
+		{
+			case 'q': nqueries = atol( optarg); break;
+			case 'z': skew = strtod( optarg, NULL); break;
+			default: usage( argv[0]); return 1;
+		}
+	}
+	if (optind < argc) filename = argv[optind];
+	if (nqueries < 1 || skew < 0)
+	{
+		usage( argv[0]);
+		return 1;
+	}
+
+	// 질의할 단어 목록 (단어순으로 만든 사전의 단어를 섞음)
+	if ((list = build_list( filename, LIST_SORTED, &ms, &cmp, &ntokens)) == NULL)
+	{
+		fprintf( stderr, "cannot open file : %s\n", filename);
+		return 1;
+	}
+	vocab = (tWord **)malloc( countList( list) * sizeof(tWord *));
+	traverseList( list, collect_word);
+	if (nvocab == 0)
+	{
+		fprintf( stderr, "no words in %s\n", filename);
+		return 1;
+	}
+	for (int i = nvocab - 1; i > 0; i--)
+	{
+		int j = bench_Rand() % (i + 1);
+		tWord *t = vocab[i];
+
+		vocab[i] = vocab[j];
+		vocab[j] = t;
+	}
+
+	// Zipf 질의: k번째 단어의 확률이 1/k^s에 비례
+	cdf = (double *)malloc( nvocab * sizeof(double));
+	for (int k = 0; k < nvocab; k++)
+	{
+		sum += 1.0 / pow( k + 1, skew);
+		cdf[k] = sum;
+	}
+	queries = (tWord **)malloc( nqueries * sizeof(tWord *));
+	for (long i = 0; i < nqueries; i++)
+	{
+		double u = bench_RandDouble() * sum;
+		int lo = 0, hi = nvocab - 1;
+
+		while (lo < hi)
+		{
+			int mid = (lo + hi) / 2;
+
+			if (cdf[mid] < u) lo = mid + 1;
+			else hi = mid;
+		}
+		queries[i] = vocab[lo];
+	}
+
+	printf( "mode,words,build_ms,cmp_per_insert,queries,query_ms,cmp_per_query,found\n");
+	for (int m = 0; m < NUM_MODES; m++)
+	{
+		LIST *mlist = build_list( filename, modes[m].mode, &ms, &cmp, &ntokens);
+		long found = 0;
+		double query_ms;
+		void *ptr;
+
+		printf( "%s,%d,%.3f,%.2f,", modes[m].name, countList( mlist), ms, (double)cmp / ntokens);
+
+		ncmp = 0;
+		ms = now_ms();
+		for (long i = 0; i < nqueries; i++) found += searchNode( mlist, queries[i], &ptr);
+		query_ms = now_ms() - ms;
+
+		printf( "%ld,%.3f,%.2f,%ld\n", nqueries, query_ms, (double)ncmp / nqueries, found);
+		fflush( stdout);
+
+		destroyList( mlist, destroy_word);
+	}
+
+	destroyList( list, destroy_word);
+	free( vocab);
+	free( cdf);
+	free( queries);
+
+	return 0;
+}
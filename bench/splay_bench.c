@@ -0,0 +1,200 @@
+#include <stdio.h>
+#include <stdlib.h> // malloc, free, atol, strtod, mkstemp
+#include <unistd.h> // close, unlink, getopt
+#include <math.h> // pow
+
+#include "bench_util.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Zipf 질의에서 splay tree와 균형 트리 비교
+// 무작위 단어 사전과 Zipf 분포(k번째 단어의 확률이 1/k^s에 비례)의 S 질의 파일을 만든 뒤,
+// 각 backend를 --batch-each로 실행 (질의마다 사전을 탐색)
+// 세 backend 모두 counting pass 후 *_BuildSorted로 같은 균형 트리에서 시작하며,
+// splay tree는 탐색할 때마다 찾은 단어를 루트로 올리므로 자주 찾는 단어일수록 적게 비교함
+// 시간과 비교 횟수는 backend가 -DWC_STATS로 보고하는 질의 처리 구간 (lookup_ms, lookup_cmp)
+//
+// skew,backend,words,queries,lookup_ms,cmp_per_query,same_output
+
+#define MAX_WORD_LEN	16		// 생성하는 단어의 최대 길이
+
+// backend 정의 (bench 디렉토리에 빌드된 메뉴 방식 실행 파일)
+// same_output은 첫 backend의 출력과 비교
+static const struct {
+	const char	*name;
+	const char	*program;
+} backends[] = {
+	{ "avlt",	"word_count7" },
+	{ "bst",	"word_count6" },
+	{ "splay",	"word_count6_splay" },
+};
+#define NUM_BACKENDS	(int)(sizeof(backends) / sizeof(backends[0]))
+
+// 기본으로 측정하는 skew (s = 0이면 균등 분포)
+static const double default_skews[] = { 0.0, 0.8, 1.0, 1.2, 1.5 };
+#define NUM_DEFAULT_SKEWS	(int)(sizeof(default_skews) / sizeof(default_skews[0]))
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+// 서로 다른 무작위 단어 nvocab개 생성 (길이 3 ~ MAX_WORD_LEN - 1, 소문자, 무작위 순서)
+// 뒤에 붙인 번호로 중복을 없앰
+static char **make_vocab( int nvocab)
+{
+	char **vocab = (char **)malloc( nvocab * sizeof(char *));
+
+	for (int i = 0; i < nvocab; i++)
+	{
+		int len = 3 + bench_Rand() % (MAX_WORD_LEN - 3);
+
+		vocab[i] = (char *)malloc( len + 12);
+		for (int j = 0; j < len; j++) vocab[i][j] = 'a' + bench_Rand() % 26;
+		sprintf( vocab[i] + len, "%d", i);
+	}
+	return vocab;
+}
+
+// 사전 파일 (단어마다 한 줄)
+static int write_dict( const char *path, char **vocab, int nvocab)
+{
+	FILE *fp = fopen( path, "w");
+
+	if (fp == NULL) return 0;
+
+	for (int i = 0; i < nvocab; i++) fprintf( fp, "%s\n", vocab[i]);
+	return fclose( fp) == 0;
+}
+
+// Zipf 질의 파일 ("S word" 한 줄에 하나)
+// 순위는 vocab의 순서 (vocab은 무작위 순서이므로 자주 찾는 단어는 사전 전체에 흩어져 있음)
+static int write_queries( const char *path, char **vocab, int nvocab, long nqueries, double skew)
+{
+	FILE *fp = fopen( path, "w");
+	double *cdf = (double *)malloc( nvocab * sizeof(double));
+	double sum = 0;
+
+	if (fp == NULL || cdf == NULL)
+	{
+		if (fp) fclose( fp);
+		free( cdf);
+		return 0;
+	}
+
+	for (int k = 0; k < nvocab; k++)
+	{
+		sum += 1.0 / pow( k + 1, skew);
+		cdf[k] = sum;
+	}
+	for (long i = 0; i < nqueries; i++)
+	{
+		double u = bench_RandDouble() * sum;
+		int lo = 0, hi = nvocab - 1;
+
+		while (lo < hi)
+		{
+			int mid = (lo + hi) / 2;
+
+			if (cdf[mid] < u) lo = mid + 1;
+			else hi = mid;
+		}
+		fprintf( fp, "S %s\n", vocab[lo]);
+	}
+
+	free( cdf);
+	return fclose( fp) == 0;
+}
+
+// backend를 --batch-each로 한 번 실행하고 표준 출력을 out에 저장
+// return	질의 처리 시간 (ms), *cmp에 질의 처리 중의 비교 횟수
+//			-1 if the backend failed
+static double run_backend( const char *program, const char *queries, const char *input,
+						   const char *out, unsigned long long *cmp)
+{
+	char path[512];
+	char *argv[] = { path, "--batch-each", (char *)queries, (char *)input, NULL };
+
+	snprintf( path, sizeof(path), "./%s", program);
+	return bench_RunLookup( argv, out, cmp);
+}
+
+static void usage( const char *prog)
+{
+	fprintf( stderr, "Usage: %s [-q QUERIES] [-v VOCAB] [-z SKEW]\n\n", prog);
+	fprintf( stderr, "\t-q QUERIES\tnumber of queries (default 1000000)\n");
+	fprintf( stderr, "\t-v VOCAB\tnumber of words in the dictionary (default 100000)\n");
+	fprintf( stderr, "\t-z SKEW\t\tZipf exponent s (default 0, 0.8, 1.0, 1.2 and 1.5)\n");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int main( int argc, char **argv)
+{
+	long nqueries = 1000000;
+	int nvocab = 100000, opt;
+	double skew = -1;
+	const double *skews = default_skews;
+	int nskews = NUM_DEFAULT_SKEWS;
+	char dict[] = "/tmp/wc_dict.XXXXXX";
+	char queries[] = "/tmp/wc_queries.XXXXXX";
+	char out_ref[] = "/tmp/wc_ref.XXXXXX";
+	char out[] = "/tmp/wc_out.XXXXXX";
+	char **vocab;
+
+	while ((opt = getopt( argc, argv, "q:v:z:")) != -1)
+	{
+		switch (opt)
+		{
+			case 'q': nqueries = atol( optarg); break;
+			case 'v': nvocab = atoi( optarg); break;
+			case 'z': skew = strtod( optarg, NULL); break;
+			default: usage( argv[0]); return 1;
+		}
+	}
+	if (nqueries < 1 || nvocab < 1 || (skew < 0 && skew != -1))
+	{
+		usage( argv[0]);
+		return 1;
+	}
+	if (skew >= 0)
+	{
+		skews = &skew;
+		nskews = 1;
+	}
+
+	vocab = make_vocab( nvocab);
+	close( mkstemp( dict));
+	close( mkstemp( queries));
+	close( mkstemp( out_ref));
+	close( mkstemp( out));
+	if (!write_dict( dict, vocab, nvocab))
+	{
+		fprintf( stderr, "cannot write dictionary : %s\n", dict);
+		return 2;
+	}
+
+	printf( "skew,backend,words,queries,lookup_ms,cmp_per_query,same_output\n");
+	for (int z = 0; z < nskews; z++)
+	{
+		if (!write_queries( queries, vocab, nvocab, nqueries, skews[z]))
+		{
+			fprintf( stderr, "cannot write queries : %s\n", queries);
+			return 2;
+		}
+
+		for (int i = 0; i < NUM_BACKENDS; i++)
+		{
+			unsigned long long cmp = 0;
+			double ms = run_backend( backends[i].program, queries, dict, i == 0 ? out_ref : out, &cmp);
+
+			if (ms < 0) printf( "%.1f,%s,%d,%ld,,,\n", skews[z], backends[i].name, nvocab, nqueries);
+			else printf( "%.1f,%s,%d,%ld,%.1f,%.2f,%d\n", skews[z], backends[i].name, nvocab, nqueries,
+						 ms, (double)cmp / nqueries, i == 0 ? 1 : bench_SameFile( out_ref, out));
+			fflush( stdout);
+		}
+	}
+
+	unlink( dict);
+	unlink( queries);
+	unlink( out_ref);
+	unlink( out);
+	for (int i = 0; i < nvocab; i++) free( vocab[i]);
+	free( vocab);
+	return 0;
+}
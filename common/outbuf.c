@@ -0,0 +1,347 @@
+#include <stdlib.h> // malloc, free, atexit
+#include <string.h> // memcpy, strlen
+#include <errno.h> // errno, EINTR
+#include <fcntl.h> // open, fcntl
+#include <unistd.h> // write, close, lseek, ftruncate, sysconf
+#include <sys/mman.h> // mmap, munmap
+#include <sys/stat.h> // fstat
+#include <sys/uio.h> // writev
+
+#include "outbuf.h"
+
+// 두 자리 수의 10진 표현 ("00" ~ "99")
+static const char digit_pairs[201] =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+
+// 표준 출력용 writer (메모리 할당 없이 항상 사용 가능)
+static char stdout_buf[OUT_BUF_SIZE];
+static OUTBUF stdout_out = { .fd = 1, .buf = stdout_buf, .cap = OUT_BUF_SIZE };
+static int stdout_registered = 0;
+
+// internal function
+// len 바이트를 모두 쓸 때까지 반복 (부분 쓰기, EINTR 처리)
+// return	1 if successful
+//			0 if a write failed
+static int _writeAll( int fd, const char *data, size_t len){
+	while (len > 0) {
+		ssize_t n = write(fd, data, len);
+
+		if (n < 0) {
+			if (errno == EINTR) continue;
+			return 0;
+		}
+		data += n;
+		len -= n;
+	}
+	return 1;
+}
+
+// internal function
+// 버퍼의 내용과 data를 writev 한 번으로 출력 (큰 데이터는 버퍼에 복사하지 않음)
+static int _writeBoth( OUTBUF *out, const char *data, size_t len){
+	struct iovec iov[2];
+	size_t total = out->len + len;
+
+	iov[0].iov_base = out->buf;
+	iov[0].iov_len = out->len;
+	iov[1].iov_base = (void *)data;
+	iov[1].iov_len = len;
+
+	while (total > 0) {
+		ssize_t n = writev(out->fd, iov, 2);
+
+		if (n < 0) {
+			if (errno == EINTR) continue;
+			return 0;
+		}
+		total -= n;
+
+		// 부분 쓰기: 남은 부분부터 다시 씀
+		if ((size_t)n >= iov[0].iov_len) {
+			n -= iov[0].iov_len;
+			iov[0].iov_len = 0;
+			iov[1].iov_base = (char *)iov[1].iov_base + n;
+			iov[1].iov_len -= n;
+		}
+		else {
+			iov[0].iov_base = (char *)iov[0].iov_base + n;
+			iov[0].iov_len -= n;
+		}
+	}
+	return 1;
+}
+
+// internal function
+// 파일의 offset 위치부터 OUT_MAP_CHUNK 바이트를 매핑 (필요하면 파일을 늘림)
+// return	1 if successful
+//			0 if failed
+static int _map( OUTBUF *out, off_t offset){
+	off_t end = offset + OUT_MAP_CHUNK;
+	void *p;
+
+	if (end > out->fsize && ftruncate(out->fd, end) < 0) return 0;
+
+	p = mmap(NULL, OUT_MAP_CHUNK, PROT_READ | PROT_WRITE, MAP_SHARED, out->fd, offset);
+	if (p == MAP_FAILED) return 0;
+
+	out->buf = (char *)p;
+	out->offset = offset;
+	out->cap = OUT_MAP_CHUNK;
+	return 1;
+}
+
+// internal function
+// mmap 모드를 설정 (fd가 읽기/쓰기로 열린 일반 파일인 경우)
+// return	1 if successful
+//			0 if mmap cannot be used
+static int _openMap( OUTBUF *out){
+	struct stat st;
+	off_t pos, page = sysconf(_SC_PAGESIZE);
+	int fl = fcntl(out->fd, F_GETFL);
+
+	if (fl < 0 || (fl & O_ACCMODE) != O_RDWR) return 0;
+	if (fstat(out->fd, &st) < 0 || !S_ISREG(st.st_mode)) return 0;
+
+	pos = (fl & O_APPEND) ? st.st_size : lseek(out->fd, 0, SEEK_CUR);
+	if (pos < 0) return 0;
+
+	out->fsize = st.st_size;
+	if (!_map(out, pos - pos % page)) {
+		// _map에서 늘린 파일 크기를 되돌리고 write 모드로 진행
+		if (ftruncate(out->fd, st.st_size) < 0) out->error = 1;
+		return 0;
+	}
+	out->len = pos % page; // 페이지 경계 앞부분은 기존 파일 내용
+	out->is_mmap = 1;
+	return 1;
+}
+
+// internal function
+// mmap 모드: 다음 구간을 매핑
+static int _advanceMap( OUTBUF *out){
+	off_t next = out->offset + out->cap;
+
+	munmap(out->buf, out->cap);
+	out->buf = NULL;
+	out->len = 0;
+	out->cap = 0;
+
+	if (!_map(out, next)) {
+		out->error = 1;
+		return 0;
+	}
+	return 1;
+}
+
+// internal function
+static void _flushStdout( void){
+	out_Flush(&stdout_out);
+}
+
+/* Creates an output writer on an open file descriptor
+	OUT_MMAP이어도 fd가 읽기/쓰기로 열린 일반 파일이 아니면 write 모드를 사용
+	return	writer pointer
+			NULL if overflow
+*/
+OUTBUF *out_Open( int fd, int flags){
+	OUTBUF *out = (OUTBUF *)malloc(sizeof(OUTBUF));
+
+	if (out == NULL) return NULL;
+
+	out->fd = fd;
+	out->is_mmap = 0;
+	out->buf = NULL;
+	out->len = 0;
+	out->cap = 0;
+	out->offset = 0;
+	out->fsize = 0;
+	out->error = 0;
+	out->owns_fd = 0;
+
+	if ((flags & OUT_MMAP) && _openMap(out)) return out;
+
+	out->buf = (char *)malloc(OUT_BUF_SIZE);
+	if (out->buf == NULL) {
+		free(out);
+		return NULL;
+	}
+	out->cap = OUT_BUF_SIZE;
+
+	return out;
+}
+
+/* Creates (or truncates) a file and opens a writer on it
+	파일은 읽기/쓰기로 열리므로 OUT_MMAP을 사용할 수 있음
+	return	writer pointer
+			NULL if the file cannot be created or overflow
+*/
+OUTBUF *out_Create( const char *filename, int flags){
+	int fd = open(filename, O_RDWR | O_CREAT | O_TRUNC, 0644);
+	OUTBUF *out;
+
+	if (fd < 0) return NULL;
+
+	if ((out = out_Open(fd, flags)) == NULL) {
+		close(fd);
+		return NULL;
+	}
+	out->owns_fd = 1;
+
+	return out;
+}
+
+/* Flushes and closes the writer
+	out_Create로 연 파일은 닫고, out_Open에 전달한 fd는 닫지 않음
+	return	1 if everything was written
+			0 if a write failed
+*/
+int out_Close( OUTBUF *out){
+	int ok;
+
+	if (out == NULL) return 1;
+
+	if (out->is_mmap) {
+		off_t end = out->offset + out->len;
+
+		if (out->buf != NULL) munmap(out->buf, out->cap);
+
+		// 미리 늘려 둔 부분을 잘라내고 파일 위치를 기록한 끝으로 옮김
+		if (ftruncate(out->fd, end > out->fsize ? end : out->fsize) < 0) out->error = 1;
+		lseek(out->fd, end, SEEK_SET);
+	}
+	else {
+		out_Flush(out);
+		if (out == &stdout_out) return !out->error; // 공유 writer는 해제하지 않음
+		free(out->buf);
+	}
+
+	ok = !out->error;
+	if (out->owns_fd && close(out->fd) < 0) ok = 0;
+	free(out);
+
+	return ok;
+}
+
+/* Writes buffered data to the file
+	printf 등 stdio 출력과 섞어 쓸 때는 각 출력 구간의 끝에서 호출
+	return	1 if successful
+			0 if a write failed
+*/
+int out_Flush( OUTBUF *out){
+	// mmap 모드는 기록이 곧 파일 내용이므로 할 일이 없음
+	if (out->is_mmap) return !out->error;
+
+	if (out->len > 0 && !out->error) {
+		if (!_writeAll(out->fd, out->buf, out->len)) out->error = 1;
+	}
+	out->len = 0;
+
+	return !out->error;
+}
+
+/* Returns the shared writer for standard output
+	stdio의 stdout과 섞어 쓸 때는 출력 구간 앞에서 fflush(stdout), 끝에서 out_Flush를 호출
+	프로그램이 끝날 때 남은 데이터는 자동으로 출력됨
+*/
+OUTBUF *out_Stdout( void){
+	if (!stdout_registered) {
+		atexit(_flushStdout);
+		stdout_registered = 1;
+	}
+	return &stdout_out;
+}
+
+/* Appends len bytes
+*/
+void out_Write( OUTBUF *out, const char *data, size_t len){
+	if (out->error) return;
+
+	if (out->is_mmap) {
+		while (len > out->cap - out->len) {
+			size_t n = out->cap - out->len;
+
+			memcpy(out->buf + out->len, data, n);
+			out->len += n;
+			data += n;
+			len -= n;
+			if (!_advanceMap(out)) return;
+		}
+		memcpy(out->buf + out->len, data, len);
+		out->len += len;
+		return;
+	}
+
+	if (len <= out->cap - out->len) {
+		memcpy(out->buf + out->len, data, len);
+		out->len += len;
+	}
+	else if (len >= out->cap / 2) {
+		// 큰 데이터는 버퍼에 복사하지 않고 버퍼의 내용과 함께 출력
+		if (!_writeBoth(out, data, len)) out->error = 1;
+		out->len = 0;
+	}
+	else {
+		out_Flush(out);
+		memcpy(out->buf, data, len);
+		out->len = len;
+	}
+}
+
+/* Appends a '\0'-terminated string
+*/
+void out_Str( OUTBUF *out, const char *str){
+	out_Write(out, str, strlen(str));
+}
+
+/* Appends a character
+*/
+void out_Char( OUTBUF *out, char c){
+	if (out->len < out->cap) out->buf[out->len++] = c;
+	else out_Write(out, &c, 1);
+}
+
+/* Appends a decimal integer (printf "%d"와 같음)
+*/
+void out_Int( OUTBUF *out, int n){
+	out_IntPad(out, n, 0);
+}
+
+/* Appends a decimal integer right-aligned in width columns (printf "%*d"와 같음)
+*/
+void out_IntPad( OUTBUF *out, int n, int width){
+	char tmp[16];
+	char *p = tmp + sizeof(tmp);
+	unsigned int u = (n < 0) ? 0u - (unsigned int)n : (unsigned int)n;
+	int len;
+
+	// 뒤에서부터 두 자리씩 채움
+	while (u >= 100) {
+		unsigned int r = u % 100;
+
+		u /= 100;
+		p -= 2;
+		memcpy(p, digit_pairs + r * 2, 2);
+	}
+	if (u >= 10) {
+		p -= 2;
+		memcpy(p, digit_pairs + u * 2, 2);
+	}
+	else {
+		*--p = (char)('0' + u);
+	}
+	if (n < 0) *--p = '-';
+
+	len = (int)(tmp + sizeof(tmp) - p);
+	while (width-- > len) out_Char(out, ' ');
+
+	out_Write(out, p, len);
+}
@@ -0,0 +1,85 @@
+#include <stddef.h> // size_t
+#include <sys/types.h> // off_t
+
+////////////////////////////////////////////////////////////////////////////////
+// OUTBUF type definition
+
+#ifndef OUT_BUF_SIZE
+#define OUT_BUF_SIZE	(1024 * 1024)		// write 모드의 버퍼 크기 (1MB)
+#endif
+#ifndef OUT_MAP_CHUNK
+#define OUT_MAP_CHUNK	(16 * 1024 * 1024)	// mmap 모드에서 파일을 늘리는 단위 (16MB)
+#endif
+
+// out_Open flags
+#define OUT_MMAP		1	// 읽기/쓰기로 열린 일반 파일이면 mmap 영역에 직접 기록 (아니면 write 모드)
+
+typedef struct
+{
+	int		fd;
+	int		is_mmap;	// 1: mmap 영역에 기록, 0: 버퍼에 모았다가 write/writev
+	char	*buf;		// 버퍼 또는 현재 매핑된 영역
+	size_t	len;		// buf에 기록한 바이트 수
+	size_t	cap;		// buf의 크기
+	off_t	offset;		// buf 시작 위치의 파일 오프셋 (mmap 모드)
+	off_t	fsize;		// 열 때의 파일 크기 (mmap 모드, 닫을 때 이보다 줄이지 않음)
+	int		owns_fd;	// out_Create로 연 파일이면 1 (out_Close에서 닫음)
+	int		error;		// 쓰기에 실패한 적이 있으면 1 (이후 출력은 버림)
+} OUTBUF;
+
+////////////////////////////////////////////////////////////////////////////////
+// function declarations
+
+/* Creates an output writer on an open file descriptor
+	OUT_MMAP이어도 fd가 읽기/쓰기로 열린 일반 파일이 아니면 write 모드를 사용
+	return	writer pointer
+			NULL if overflow
+*/
+OUTBUF *out_Open( int fd, int flags);
+
+/* Creates (or truncates) a file and opens a writer on it
+	파일은 읽기/쓰기로 열리므로 OUT_MMAP을 사용할 수 있음
+	return	writer pointer
+			NULL if the file cannot be created or overflow
+*/
+OUTBUF *out_Create( const char *filename, int flags);
+
+/* Flushes and closes the writer
+	out_Create로 연 파일은 닫고, out_Open에 전달한 fd는 닫지 않음
+	return	1 if everything was written
+			0 if a write failed
+*/
+int out_Close( OUTBUF *out);
+
+/* Writes buffered data to the file
+	printf 등 stdio 출력과 섞어 쓸 때는 각 출력 구간의 끝에서 호출
+	return	1 if successful
+			0 if a write failed
+*/
+int out_Flush( OUTBUF *out);
+
+/* Returns the shared writer for standard output
+	stdio의 stdout과 섞어 쓸 때는 출력 구간 앞에서 fflush(stdout), 끝에서 out_Flush를 호출
+	프로그램이 끝날 때 남은 데이터는 자동으로 출력됨
+*/
+OUTBUF *out_Stdout( void);
+
+/* Appends len bytes
+*/
+void out_Write( OUTBUF *out, const char *data, size_t len);
+
+/* Appends a '\0'-terminated string
+*/
+void out_Str( OUTBUF *out, const char *str);
+
+/* Appends a character
+*/
+void out_Char( OUTBUF *out, char c);
+
+/* Appends a decimal integer (printf "%d"와 같음)
+*/
+void out_Int( OUTBUF *out, int n);
+
+/* Appends a decimal integer right-aligned in width columns (printf "%*d"와 같음)
+*/
+void out_IntPad( OUTBUF *out, int n, int width);
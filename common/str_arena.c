@@ -0,0 +1,181 @@
+#include <stdlib.h> // malloc, calloc, free
+#include <string.h> // memcpy, strncmp, strlen
+
+#include "str_arena.h"
+
+// internal function
+// 문자열의 해시값 계산 (FNV-1a)
+static unsigned int _hash( const char *str, size_t len){
+	unsigned int h = 2166136261u;
+
+	for (size_t i = 0; i < len; i++) {
+		h ^= (unsigned char)str[i];
+		h *= 16777619u;
+	}
+	return h;
+}
+
+// internal function
+// size 바이트 이상을 담을 수 있는 새 블록을 할당하여 블록 목록의 앞에 연결
+// return	new block
+//			NULL if overflow
+static ARENA_BLOCK *_newBlock( STRARENA *arena, size_t size){
+	ARENA_BLOCK *block;
+
+	if (size < ARENA_BLOCK_SIZE) size = ARENA_BLOCK_SIZE;
+
+	block = (ARENA_BLOCK *)malloc(sizeof(ARENA_BLOCK) + size);
+	if (block == NULL) return NULL;
+
+	block->next = arena->blocks;
+	block->used = 0;
+	block->size = size;
+	arena->blocks = block;
+
+	return block;
+}
+
+// internal function
+// len + 1 바이트를 bump-pointer로 할당하여 문자열을 복사
+static char *_alloc( STRARENA *arena, const char *str, size_t len){
+	ARENA_BLOCK *block = arena->blocks;
+	char *p;
+
+	if (block == NULL || block->size - block->used < len + 1) {
+		// 긴 문자열은 전용 블록에 저장하고, 현재 블록은 계속 사용
+		if (block != NULL && len + 1 > ARENA_BLOCK_SIZE / 4) {
+			ARENA_BLOCK *big = (ARENA_BLOCK *)malloc(sizeof(ARENA_BLOCK) + len + 1);
+			if (big == NULL) return NULL;
+
+			big->used = big->size = len + 1;
+			big->next = block->next;
+			block->next = big;
+			p = big->mem;
+			memcpy(p, str, len);
+			p[len] = '\0';
+			return p;
+		}
+		if ((block = _newBlock(arena, len + 1)) == NULL) return NULL;
+	}
+
+	p = block->mem + block->used;
+	block->used += len + 1;
+
+	memcpy(p, str, len);
+	p[len] = '\0';
+	return p;
+}
+
+// internal function
+// 인터닝 테이블의 슬롯 수를 2배로 늘림
+// 슬롯에는 포인터만 저장하므로 (슬롯당 8 byte) 문자열을 다시 해싱
+// return	1 if successful
+//			0 if overflow
+static int _grow( STRARENA *arena){
+	int n = arena->nslots * 2;
+	const char **slots = (const char **)calloc(n, sizeof(const char *));
+
+	if (slots == NULL) return 0;
+
+	for (int i = 0; i < arena->nslots; i++) {
+		const char *str = arena->slots[i];
+
+		if (str != NULL) {
+			int j = _hash(str, strlen(str)) & (n - 1);
+
+			while (slots[j] != NULL) j = (j + 1) & (n - 1);
+			slots[j] = str;
+		}
+	}
+	free(arena->slots);
+	arena->slots = slots;
+	arena->nslots = n;
+
+	return 1;
+}
+
+/* Allocates an empty string arena
+	return	arena pointer
+			NULL if overflow
+*/
+STRARENA *strarena_Create( void){
+	STRARENA *arena = (STRARENA *)malloc(sizeof(STRARENA));
+
+	if (arena == NULL) return NULL;
+
+	arena->slots = (const char **)calloc(ARENA_INIT_SLOTS, sizeof(const char *));
+	if (arena->slots == NULL) {
+		free(arena);
+		return NULL;
+	}
+	arena->nslots = ARENA_INIT_SLOTS;
+	arena->count = 0;
+	arena->bytes = 0;
+	arena->blocks = NULL;
+
+	return arena;
+}
+
+/* Recycles all strings in the arena at once
+	arena에서 받은 모든 포인터는 더 이상 사용할 수 없음
+*/
+void strarena_Destroy( STRARENA *arena){
+	if (arena == NULL) return;
+
+	while (arena->blocks != NULL) {
+		ARENA_BLOCK *next = arena->blocks->next;
+		free(arena->blocks);
+		arena->blocks = next;
+	}
+	free(arena->slots);
+	free(arena);
+}
+
+/* Interns a string of len bytes
+	같은 문자열에 대해서는 항상 같은 포인터를 반환 (strarena_Destroy 전까지 유효)
+	return	pointer to the interned string ('\0'으로 끝남)
+			NULL if overflow
+*/
+const char *strarena_Intern( STRARENA *arena, const char *str, size_t len){
+	int mask = arena->nslots - 1;
+	int i = _hash(str, len) & mask;
+	char *p;
+
+	// linear probing
+	while (arena->slots[i] != NULL) {
+		const char *s = arena->slots[i];
+
+		if (s[0] == str[0] && strncmp(s, str, len) == 0 && s[len] == '\0') {
+			return s; // 이미 저장된 문자열
+		}
+		i = (i + 1) & mask;
+	}
+
+	if ((p = _alloc(arena, str, len)) == NULL) return NULL;
+
+	arena->slots[i] = p;
+	arena->count++;
+	arena->bytes += len + 1;
+
+	// load factor 3/4를 넘으면 확장 (실패하면 현재 테이블을 계속 사용)
+	if (arena->count * 4 > arena->nslots * 3) _grow(arena);
+
+	return p;
+}
+
+/* returns number of distinct strings in the arena
+*/
+int strarena_Count( STRARENA *arena){
+	return arena->count;
+}
+
+/* returns total bytes used by the arena (blocks and interning table)
+*/
+size_t strarena_Memory( STRARENA *arena){
+	size_t total = sizeof(STRARENA) + arena->nslots * sizeof(const char *);
+
+	for (ARENA_BLOCK *b = arena->blocks; b != NULL; b = b->next) {
+		total += sizeof(ARENA_BLOCK) + b->size;
+	}
+	return total;
+}
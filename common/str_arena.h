@@ -0,0 +1,54 @@
+#include <stddef.h> // size_t
+
+////////////////////////////////////////////////////////////////////////////////
+// STRARENA type definition
+
+#define ARENA_BLOCK_SIZE	(64 * 1024)	// 문자열 블록의 기본 크기
+#define ARENA_INIT_SLOTS	1024		// 인터닝 테이블의 초기 슬롯 수 (2의 거듭제곱)
+
+// 문자열 블록 (bump-pointer 할당)
+typedef struct arena_block
+{
+	struct arena_block	*next;	// 이전에 할당된 블록
+	size_t			used;	// 사용한 바이트 수
+	size_t			size;	// 블록의 크기
+	char			mem[];	// 문자열 저장 영역
+} ARENA_BLOCK;
+
+typedef struct
+{
+	int		count;		// 저장된 (서로 다른) 문자열의 수
+	size_t	bytes;		// 문자열에 사용한 바이트 수 ('\0' 포함)
+	ARENA_BLOCK	*blocks;	// 현재 블록 (가장 최근에 할당된 블록)
+	int		nslots;		// 인터닝 테이블의 슬롯 수
+	const char	**slots;	// 인터닝 테이블 (open addressing, NULL이면 빈 슬롯)
+} STRARENA;
+
+////////////////////////////////////////////////////////////////////////////////
+// function declarations
+
+/* Allocates an empty string arena
+	return	arena pointer
+			NULL if overflow
+*/
+STRARENA *strarena_Create( void);
+
+/* Recycles all strings in the arena at once
+	arena에서 받은 모든 포인터는 더 이상 사용할 수 없음
+*/
+void strarena_Destroy( STRARENA *arena);
+
+/* Interns a string of len bytes
+	같은 문자열에 대해서는 항상 같은 포인터를 반환 (strarena_Destroy 전까지 유효)
+	return	pointer to the interned string ('\0'으로 끝남)
+			NULL if overflow
+*/
+const char *strarena_Intern( STRARENA *arena, const char *str, size_t len);
+
+/* returns number of distinct strings in the arena
+*/
+int strarena_Count( STRARENA *arena);
+
+/* returns total bytes used by the arena (blocks and interning table)
+*/
+size_t strarena_Memory( STRARENA *arena);
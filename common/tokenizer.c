@@ -0,0 +1,362 @@
+#include <stdlib.h> // malloc, realloc, free
+#include <string.h> // memmove, memcpy, strcmp
+#include <errno.h> // errno, EINTR
+#include <fcntl.h> // open
+#include <unistd.h> // read, close, sysconf
+#include <sys/mman.h> // mmap, munmap, madvise
+#include <sys/stat.h> // fstat
+
+#include "tokenizer.h"
+
+// fscanf의 "%s"와 같은 구분자 (' ', '\t', '\n', '\v', '\f', '\r')
+#define _isspace(c)	((c) == ' ' || ((c) >= '\t' && (c) <= '\r'))
+
+// internal function
+// mmap 모드에서 윈도우를 이동 (keep 위치를 포함하는 페이지부터 다시 매핑)
+// 토큰이 윈도우보다 길어서 앞으로 나아갈 수 없으면 윈도우를 2배로 늘림
+// return	1 if new data is available
+//			0 end of file
+static int _slide_mmap( TOKENIZER *tok, off_t keep){
+	long pagesz = sysconf(_SC_PAGESIZE);
+	off_t newoff = keep - keep % pagesz;
+	size_t len;
+	char *map;
+	int prot = PROT_READ | ((tok->flags & TOK_CSTR) ? PROT_WRITE : 0);
+
+	if (tok->offset + (off_t)tok->buflen >= tok->fsize) return 0; // 파일 끝
+
+	if (tok->buf != NULL && newoff == tok->offset) tok->bufcap *= 2;
+
+	len = (tok->fsize - newoff < (off_t)tok->bufcap) ? (size_t)(tok->fsize - newoff) : tok->bufcap;
+
+	// 쓰기는 MAP_PRIVATE 페이지에만 반영되고 파일에는 반영되지 않음
+	map = (char *)mmap(NULL, len, prot, MAP_PRIVATE, tok->fd, newoff);
+	if (map == MAP_FAILED) return 0;
+	madvise(map, len, MADV_SEQUENTIAL);
+
+	if (tok->buf != NULL) munmap(tok->buf, tok->buflen);
+
+	tok->pos = (size_t)(tok->offset + (off_t)tok->pos - newoff);
+	tok->buf = map;
+	tok->buflen = len;
+	tok->offset = newoff;
+
+	return 1;
+}
+
+// internal function
+// read 모드에서 keep 이전의 데이터를 버리고 버퍼를 채움
+// 버퍼가 가득 차 있으면 (토큰이 버퍼보다 긴 경우) 버퍼를 2배로 늘림
+// return	1 if new data is available
+//			0 end of file
+static int _slide_read( TOKENIZER *tok, off_t keep){
+	size_t shift = (size_t)(keep - tok->offset);
+	ssize_t n;
+
+	if (tok->eof) return 0;
+
+	memmove(tok->buf, tok->buf + shift, tok->buflen - shift);
+	tok->offset = keep;
+	tok->buflen -= shift;
+	tok->pos -= shift;
+
+	if (tok->buflen == tok->bufcap) {
+		char *temp = (char *)realloc(tok->buf, tok->bufcap * 2 + 1); // '\0'을 위한 1 byte
+		if (temp == NULL) return 0;
+
+		tok->buf = temp;
+		tok->bufcap *= 2;
+	}
+
+	do {
+		n = read(tok->fd, tok->buf + tok->buflen, tok->bufcap - tok->buflen);
+	} while (n < 0 && errno == EINTR);
+
+	if (n <= 0) {
+		tok->eof = 1;
+		return 0;
+	}
+	tok->buflen += n;
+	return 1;
+}
+
+// internal function
+// keep : 윈도우에 남겨두어야 하는 가장 앞의 위치 (파일 오프셋)
+static int _slide( TOKENIZER *tok, off_t keep){
+	return tok->is_mmap ? _slide_mmap(tok, keep) : _slide_read(tok, keep);
+}
+
+// internal function
+// 구분자를 건너뛰어 tok->pos를 다음 토큰의 시작 위치로 옮김
+// keep이 음수이면 현재 위치 이전의 데이터는 버려도 됨
+// return	1 if a token follows
+//			0 end of file
+static int _skip_space( TOKENIZER *tok, off_t keep){
+	for (;;) {
+		while (tok->pos < tok->buflen && _isspace(tok->buf[tok->pos])) tok->pos++;
+
+		if (tok->pos < tok->buflen) return 1;
+
+		if (!_slide(tok, keep < 0 ? tok->offset + (off_t)tok->pos : keep)) return 0;
+	}
+}
+
+// internal function
+// 토큰의 끝(구분자 또는 파일 끝)까지 tok->pos를 옮김
+static void _scan_token( TOKENIZER *tok, off_t keep){
+	for (;;) {
+		while (tok->pos < tok->buflen && !_isspace(tok->buf[tok->pos])) tok->pos++;
+
+		if (tok->pos < tok->buflen) return;
+
+		if (!_slide(tok, keep)) return;
+	}
+}
+
+// internal function
+// [start, end) 구간(파일 오프셋)을 token으로 만듦
+// TOK_CSTR이면 end 위치의 구분자를 '\0'으로 덮어씀
+static void _make_token( TOKENIZER *tok, off_t start, off_t end, tToken *token){
+	size_t s = (size_t)(start - tok->offset);
+	size_t e = (size_t)(end - tok->offset);
+
+	token->ptr = tok->buf + s;
+	token->len = e - s;
+
+	if (e < tok->buflen) { // 구분자가 윈도우 안에 있음
+		if (tok->flags & TOK_CSTR) tok->buf[e] = '\0';
+		if (tok->pos == e) tok->pos++;
+	}
+	else if (tok->flags & TOK_CSTR) { // 파일 끝에서 끝나는 토큰
+		if (!tok->is_mmap) {
+			tok->buf[e] = '\0'; // read 버퍼는 1 byte 여유가 있음
+		}
+		else if (tok->fsize % sysconf(_SC_PAGESIZE) == 0) {
+			// 마지막 페이지에 여유가 없으므로 복사 (파일당 한 번)
+			char *temp = (char *)realloc(tok->tail, token->len + 1);
+			if (temp == NULL) return;
+
+			memcpy(temp, token->ptr, token->len);
+			temp[token->len] = '\0';
+			tok->tail = temp;
+			token->ptr = temp;
+		}
+		// 그 외: 파일 끝 이후의 페이지 영역은 0으로 채워져 있음
+	}
+}
+
+// internal function
+// 정수 토큰을 해석
+// return	1 if the token is an integer
+//			0 otherwise
+static int _parse_int( const char *p, size_t len, int *value){
+	int sign = 1;
+	int v = 0;
+	size_t i = 0;
+
+	if (len > 0 && (p[0] == '-' || p[0] == '+')) {
+		if (p[0] == '-') sign = -1;
+		i++;
+	}
+	if (i == len) return 0;
+
+	for (; i < len; i++) {
+		if (p[i] < '0' || p[i] > '9') return 0;
+		v = v * 10 + (p[i] - '0');
+	}
+	*value = sign * v;
+	return 1;
+}
+
+// internal function
+// 파일을 열고 tokenizer의 필드를 초기화
+// return	tokenizer pointer
+//			NULL if the file cannot be opened or overflow
+static TOKENIZER *_open( const char *filename, int flags){
+	TOKENIZER *tok = (TOKENIZER *)malloc(sizeof(TOKENIZER));
+
+	if (tok == NULL) return NULL;
+
+	if (filename == NULL || strcmp(filename, "-") == 0) {
+		tok->fd = STDIN_FILENO;
+	}
+	else if ((tok->fd = open(filename, O_RDONLY)) < 0) {
+		free(tok);
+		return NULL;
+	}
+
+	tok->flags = flags;
+	tok->buf = NULL;
+	tok->buflen = 0;
+	tok->pos = 0;
+	tok->offset = 0;
+	tok->fsize = 0;
+	tok->eof = 0;
+	tok->tail = NULL;
+	tok->is_mmap = 0;
+	tok->bufcap = 0;
+
+	return tok;
+}
+
+/* Opens a file for tokenizing
+	filename이 NULL 또는 "-"이면 표준 입력을 사용
+	일반 파일은 mmap 윈도우로, 그 외(파이프 등)는 read 버퍼로 읽음
+	return	tokenizer pointer
+			NULL if the file cannot be opened or overflow
+*/
+TOKENIZER *tok_Open( const char *filename, int flags){
+	TOKENIZER *tok = _open(filename, flags);
+	struct stat st;
+
+	if (tok == NULL) return NULL;
+
+	if (fstat(tok->fd, &st) == 0 && S_ISREG(st.st_mode)) {
+		tok->is_mmap = 1;
+		tok->fsize = st.st_size;
+		tok->bufcap = TOK_WINDOW;
+	}
+	else {
+		tok->is_mmap = 0;
+		tok->bufcap = TOK_READ_BUF;
+		tok->buf = (char *)malloc(tok->bufcap + 1);
+		if (tok->buf == NULL) {
+			if (tok->fd != STDIN_FILENO) close(tok->fd);
+			free(tok);
+			return NULL;
+		}
+	}
+	return tok;
+}
+
+/* Opens the byte range [start, end) of a regular file for tokenizing
+	start, end는 tok_Split으로 구한 경계여야 함 (경계 바로 앞의 문자는 구분자)
+	return	tokenizer pointer
+			NULL if the file cannot be opened, is not a regular file or overflow
+*/
+TOKENIZER *tok_OpenRange( const char *filename, int flags, off_t start, off_t end){
+	TOKENIZER *tok = _open(filename, flags);
+	struct stat st;
+
+	if (tok == NULL) return NULL;
+
+	if (fstat(tok->fd, &st) != 0 || !S_ISREG(st.st_mode) || end > st.st_size) {
+		tok_Close(tok);
+		return NULL;
+	}
+
+	// 구간의 끝을 파일 끝처럼 취급하고, 첫 윈도우는 start부터 매핑
+	tok->is_mmap = 1;
+	tok->fsize = end;
+	tok->offset = start;
+	tok->bufcap = TOK_WINDOW;
+
+	return tok;
+}
+
+/* Splits a regular file into n ranges at whitespace boundaries
+	bounds[0] = 0, bounds[n] = 파일 크기, i번째 구간은 [bounds[i], bounds[i+1])
+	토큰은 두 구간에 걸치지 않음
+	return	1 if successful
+			0 if the file cannot be opened or is not a regular file
+*/
+int tok_Split( const char *filename, int n, off_t bounds[]){
+	char block[4096];
+	struct stat st;
+	int fd = open(filename, O_RDONLY);
+
+	if (fd < 0) return 0;
+	if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+		close(fd);
+		return 0;
+	}
+
+	bounds[0] = 0;
+	bounds[n] = st.st_size;
+
+	for (int i = 1; i < n; i++) {
+		off_t p = st.st_size / n * i;
+		ssize_t len = 0;
+		ssize_t k = 0;
+
+		if (p < bounds[i - 1]) p = bounds[i - 1];
+
+		// p 이후 첫 번째 구분자의 다음 위치를 경계로 함
+		for (;;) {
+			len = pread(fd, block, sizeof(block), p);
+			if (len <= 0) break;
+
+			for (k = 0; k < len && !_isspace(block[k]); k++)
+				;
+			if (k < len) break;
+			p += len;
+		}
+		bounds[i] = (len > 0) ? p + k + 1 : st.st_size;
+	}
+
+	close(fd);
+	return 1;
+}
+
+/* Closes the file and recycles memory
+*/
+void tok_Close( TOKENIZER *tok){
+	if (tok == NULL) return;
+
+	if (tok->is_mmap) {
+		if (tok->buf != NULL) munmap(tok->buf, tok->buflen);
+	}
+	else free(tok->buf);
+
+	free(tok->tail);
+	if (tok->fd != STDIN_FILENO) close(tok->fd);
+	free(tok);
+}
+
+/* Gets the next whitespace-separated token
+	token은 다음 tok_Next/tok_NextRecord 호출 전까지만 유효
+	TOK_CSTR이면 token->ptr은 '\0'으로 끝남
+	return	1 if successful
+			0 end of file
+*/
+int tok_Next( TOKENIZER *tok, tToken *token){
+	off_t start;
+
+	if (!_skip_space(tok, -1)) return 0;
+
+	start = tok->offset + tok->pos;
+	_scan_token(tok, start);
+	_make_token(tok, start, tok->offset + tok->pos, token);
+
+	return 1;
+}
+
+/* Gets the next "word\tfreq" record
+	빈도 필드가 숫자가 아니거나 없으면 읽지 않고 *freq는 1
+	return	1 if successful
+			0 end of file
+*/
+int tok_NextRecord( TOKENIZER *tok, tToken *token, int *freq){
+	off_t start, end, num;
+
+	if (!_skip_space(tok, -1)) return 0;
+
+	start = tok->offset + tok->pos;
+	_scan_token(tok, start);
+	end = tok->offset + tok->pos;
+
+	*freq = 1;
+	if (_skip_space(tok, start)) {
+		num = tok->offset + tok->pos;
+		_scan_token(tok, start);
+
+		// 빈도 필드가 아니면 다음 토큰으로 남겨둠
+		if (!_parse_int(tok->buf + (num - tok->offset), tok->offset + tok->pos - num, freq)) {
+			tok->pos = (size_t)(num - tok->offset);
+			*freq = 1;
+		}
+	}
+	_make_token(tok, start, end, token);
+
+	return 1;
+}
@@ -0,0 +1,82 @@
+#include <stddef.h> // size_t
+#include <sys/types.h> // off_t
+
+////////////////////////////////////////////////////////////////////////////////
+// TOKENIZER type definition
+
+#ifndef TOK_WINDOW
+#define TOK_WINDOW		(64 * 1024 * 1024)	// 한 번에 매핑하는 윈도우 크기 (64MB)
+#endif
+#ifndef TOK_READ_BUF
+#define TOK_READ_BUF	(1024 * 1024)		// mmap을 사용할 수 없는 입력(파이프 등)의 버퍼 크기
+#endif
+
+// tok_Open flags
+#define TOK_CSTR		1	// 토큰 뒤의 구분자를 '\0'으로 덮어써서 C 문자열로 사용할 수 있게 함
+
+// 토큰 (입력 버퍼에 대한 view, 복사하지 않음)
+typedef struct
+{
+	const char	*ptr;	// 토큰 시작 위치
+	size_t		len;	// 토큰 길이
+} tToken;
+
+typedef struct
+{
+	int		fd;
+	int		flags;
+	int		is_mmap;	// 1: mmap 윈도우, 0: read 버퍼
+	char	*buf;		// 현재 윈도우 (mmap 영역 또는 read 버퍼)
+	size_t	buflen;		// 윈도우 내 유효 바이트 수
+	size_t	bufcap;		// 윈도우 크기 (mmap 최대 길이 또는 버퍼 용량)
+	size_t	pos;		// 윈도우 내 다음 탐색 위치
+	off_t	offset;		// 윈도우 시작 위치의 파일 오프셋
+	off_t	fsize;		// 파일 크기 (mmap 모드, tok_OpenRange이면 구간의 끝)
+	int		eof;		// read 모드: 더 읽을 데이터가 없음
+	char	*tail;		// 페이지 경계에서 끝나는 마지막 토큰의 복사본 (TOK_CSTR)
+} TOKENIZER;
+
+////////////////////////////////////////////////////////////////////////////////
+// function declarations
+
+/* Opens a file for tokenizing
+	filename이 NULL 또는 "-"이면 표준 입력을 사용
+	일반 파일은 mmap 윈도우로, 그 외(파이프 등)는 read 버퍼로 읽음
+	return	tokenizer pointer
+			NULL if the file cannot be opened or overflow
+*/
+TOKENIZER *tok_Open( const char *filename, int flags);
+
+/* Opens the byte range [start, end) of a regular file for tokenizing
+	start, end는 tok_Split으로 구한 경계여야 함 (경계 바로 앞의 문자는 구분자)
+	return	tokenizer pointer
+			NULL if the file cannot be opened, is not a regular file or overflow
+*/
+TOKENIZER *tok_OpenRange( const char *filename, int flags, off_t start, off_t end);
+
+/* Splits a regular file into n ranges at whitespace boundaries
+	bounds[0] = 0, bounds[n] = 파일 크기, i번째 구간은 [bounds[i], bounds[i+1])
+	토큰은 두 구간에 걸치지 않음
+	return	1 if successful
+			0 if the file cannot be opened or is not a regular file
+*/
+int tok_Split( const char *filename, int n, off_t bounds[]);
+
+/* Closes the file and recycles memory
+*/
+void tok_Close( TOKENIZER *tok);
+
+/* Gets the next whitespace-separated token
+	token은 다음 tok_Next/tok_NextRecord 호출 전까지만 유효
+	TOK_CSTR이면 token->ptr은 '\0'으로 끝남
+	return	1 if successful
+			0 end of file
+*/
+int tok_Next( TOKENIZER *tok, tToken *token);
+
+/* Gets the next "word\tfreq" record
+	빈도 필드가 숫자가 아니거나 없으면 읽지 않고 *freq는 1
+	return	1 if successful
+			0 end of file
+*/
+int tok_NextRecord( TOKENIZER *tok, tToken *token, int *freq);
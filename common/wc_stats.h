@@ -0,0 +1,65 @@
+////////////////////////////////////////////////////////////////////////////////
+// benchmark instrumentation
+// bench/Makefile이 -DWC_STATS로 빌드할 때만 동작하며, 그 외에는 모든 매크로가 비어 있음
+// 각 단계(build, lookup, dump)의 시간, 처리한 연산 수, 단어 비교 횟수를 측정하여
+// 프로그램이 끝날 때 표준 에러로 한 줄 출력 (bench 드라이버가 읽음)
+//
+// stats build_ms=.. build_ops=.. build_cmp=.. lookup_ms=.. lookup_ops=.. lookup_cmp=.. dump_ms=.. dump_ops=.. words=..
+
+#define STATS_BUILD		0	// 입력의 모든 단어를 사전에 저장
+#define STATS_LOOKUP	1	// 입력의 모든 단어를 사전에서 다시 찾음
+#define STATS_DUMP		2	// 사전 전체를 출력
+
+#ifdef WC_STATS
+
+#include <stdio.h> // fprintf
+#include <time.h> // clock_gettime
+
+static unsigned long long	stats_cmp;			// 현재 단계의 비교 횟수
+static double				stats_start;		// 현재 단계의 시작 시각 (ms)
+static double				stats_ms[3];
+static long					stats_ops[3];
+static unsigned long long	stats_cmps[3];
+static volatile long		stats_sink;			// lookup 결과를 버리지 않도록 저장
+
+static inline double _stats_now( void)
+{
+	struct timespec ts;
+
+	clock_gettime( CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+// 단어 비교 한 번
+#define STATS_CMP()				(stats_cmp++)
+
+// 단계 시작
+#define STATS_BEGIN()			(stats_cmp = 0, stats_start = _stats_now())
+
+// 단계 끝 (ops: 처리한 단어 또는 레코드 수)
+#define STATS_END( phase, ops)	(stats_ms[phase] = _stats_now() - stats_start, \
+								 stats_cmps[phase] = stats_cmp, stats_ops[phase] = (ops))
+
+// 단계의 연산 수를 나중에 설정 (build 단계의 단어 수는 lookup 단계에서 셈)
+#define STATS_OPS( phase, ops)	(stats_ops[phase] = (ops))
+
+// lookup 결과 사용
+#define STATS_SINK( x)			(stats_sink += (long)(x))
+
+// 측정 결과 출력 (words: 사전에 저장된 단어 수)
+#define STATS_REPORT( words)	fprintf( stderr, \
+	"stats build_ms=%.3f build_ops=%ld build_cmp=%llu lookup_ms=%.3f lookup_ops=%ld lookup_cmp=%llu dump_ms=%.3f dump_ops=%ld words=%d\n", \
+	stats_ms[STATS_BUILD], stats_ops[STATS_BUILD], stats_cmps[STATS_BUILD], \
+	stats_ms[STATS_LOOKUP], stats_ops[STATS_LOOKUP], stats_cmps[STATS_LOOKUP], \
+	stats_ms[STATS_DUMP], stats_ops[STATS_DUMP], (int)(words))
+
+#else
+
+#define STATS_CMP()				((void)0)
+#define STATS_BEGIN()			((void)0)
+#define STATS_END( phase, ops)	((void)0)
+#define STATS_OPS( phase, ops)	((void)0)
+#define STATS_SINK( x)			((void)0)
+#define STATS_REPORT( words)	((void)0)
+
+#endif
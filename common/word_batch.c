@@ -0,0 +1,169 @@
+#include <stdio.h> // fopen, fread, fprintf
+#include <stdlib.h> // malloc, realloc, free
+#include <string.h> // strcmp
+#include <ctype.h> // isspace, toupper
+
+#include "word_batch.h"
+#include "word_sort.h"
+
+// internal function
+// 파일 전체를 읽어 '\0'으로 끝나는 문자열로 반환
+// return	파일 내용
+//			NULL if the file cannot be read or overflow
+static char *_readAll( const char *filename){
+	FILE *fp = fopen(filename, "rb");
+	size_t size = 0, cap = 64 * 1024, n;
+	char *text;
+
+	if (fp == NULL) return NULL;
+
+	text = (char *)malloc(cap);
+	while (text != NULL && (n = fread(text + size, 1, cap - size - 1, fp)) > 0) {
+		size += n;
+		if (size + 1 == cap) {
+			char *grown = (char *)realloc(text, cap * 2);
+
+			if (grown == NULL) free(text);
+			text = grown;
+			cap *= 2;
+		}
+	}
+	if (text != NULL) text[size] = '\0';
+
+	fclose(fp);
+	return text;
+}
+
+// internal function
+// *pos부터 다음 단어를 찾아 '\0'으로 끝내고 반환
+// return	단어의 시작 (*len에 길이)
+//			NULL if no more words
+static char *_nextWord( char **pos, int *len){
+	char *p = *pos, *word;
+
+	while (*p && isspace((unsigned char)*p)) p++;
+	if (*p == '\0') return NULL;
+
+	word = p;
+	while (*p && !isspace((unsigned char)*p)) p++;
+	*len = (int)(p - word);
+	if (*p) *p++ = '\0';
+
+	*pos = p;
+	return word;
+}
+
+/* Reads a query file
+	return	batch pointer
+			NULL if the file cannot be read, overflow or a malformed query (표준 에러에 출력)
+*/
+WBATCH *wbatch_Load( const char *filename){
+	WBATCH *b = (WBATCH *)calloc(1, sizeof(WBATCH));
+	int capacity = 1024;
+	char *pos, *op, *word;
+	int oplen, len;
+
+	if (b == NULL) return NULL;
+
+	b->text = _readAll(filename);
+	b->queries = (tQuery *)malloc(capacity * sizeof(tQuery));
+	if (b->text == NULL || b->queries == NULL) {
+		fprintf(stderr, "Error: cannot read query file [%s]\n", filename);
+		wbatch_Close(b);
+		return NULL;
+	}
+
+	pos = b->text;
+	while ((op = _nextWord(&pos, &oplen)) != NULL) {
+		char c = toupper((unsigned char)op[0]);
+
+		if (oplen != 1 || (c != WBATCH_SEARCH && c != WBATCH_DELETE) || (word = _nextWord(&pos, &len)) == NULL) {
+			fprintf(stderr, "Error: malformed query %d [%s]\n", b->count + 1, op);
+			wbatch_Close(b);
+			return NULL;
+		}
+
+		if (b->count == capacity) {
+			tQuery *grown = (tQuery *)realloc(b->queries, capacity * 2 * sizeof(tQuery));
+
+			if (grown == NULL) {
+				wbatch_Close(b);
+				return NULL;
+			}
+			b->queries = grown;
+			capacity *= 2;
+		}
+
+		b->queries[b->count].op = c;
+		b->queries[b->count].word = word;
+		b->queries[b->count].len = len;
+		b->queries[b->count].result = NULL;
+		b->count++;
+	}
+
+	return b;
+}
+
+/* Recycles memory of the batch
+*/
+void wbatch_Close( WBATCH *b){
+	free(b->keys);
+	free(b->queries);
+	free(b->text);
+	free(b);
+}
+
+/* returns end of the run of search queries starting at start
+	start의 질의가 WBATCH_DELETE이면 start
+*/
+int wbatch_RunEnd( const WBATCH *b, int start){
+	int end = start;
+
+	while (end < b->count && b->queries[end].op == WBATCH_SEARCH) end++;
+	return end;
+}
+
+/* Prepares merge-join of the search queries in [start, end)
+	질의를 단어순으로 정렬하고 result를 NULL로 초기화
+	return	1 if successful
+			0 if overflow
+*/
+int wbatch_Begin( WBATCH *b, int start, int end){
+	int n = end - start;
+
+	// 가장 긴 run에 맞춰 한 번 할당 (run이 여럿이면 재사용)
+	if (b->keys == NULL) {
+		int longest = 0;
+
+		for (int i = 0; i < b->count; i = wbatch_RunEnd(b, i) + 1) {
+			int run = wbatch_RunEnd(b, i) - i;
+
+			if (run > longest) longest = run;
+		}
+		b->keys = (tQueryKey *)malloc((longest > 0 ? longest : 1) * sizeof(tQueryKey));
+		if (b->keys == NULL) return 0;
+	}
+
+	for (int i = 0; i < n; i++) {
+		b->keys[i].word = b->queries[start + i].word;
+		b->keys[i].idx = start + i;
+		b->queries[start + i].result = NULL;
+	}
+	b->nkeys = n;
+	b->cursor = 0;
+
+	return wsort_ByWord(b->keys, n, sizeof(tQueryKey), offsetof(tQueryKey, word), 0);
+}
+
+/* Matches one dictionary word (사전의 단어순 순회에서 차례로 호출)
+	word와 같은 단어의 질의에 data를 result로 설정
+*/
+void wbatch_Match( WBATCH *b, const char *word, void *data){
+	int cmp;
+
+	// word보다 작은 질의는 사전에 없음 (result는 NULL로 남음)
+	while (b->cursor < b->nkeys && (cmp = strcmp(b->keys[b->cursor].word, word)) <= 0) {
+		if (cmp == 0) b->queries[b->keys[b->cursor].idx].result = data;
+		b->cursor++;
+	}
+}
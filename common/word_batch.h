@@ -0,0 +1,79 @@
+#include <stddef.h> // size_t
+
+////////////////////////////////////////////////////////////////////////////////
+// batch query file (--batch)
+// 메뉴의 S)earch, D)elete를 파일로 모아 한 번에 처리
+// 파일은 공백으로 구분된 "연산 단어" 쌍의 나열 (연산은 S 또는 D, 대소문자 무관)
+//
+//	S apple
+//	S the
+//	D the
+//
+// 연속된 S 질의(run)는 단어순으로 정렬한 뒤, 사전의 중위(단어순) 순회 한 번과 merge-join하여 답함
+// D 질의는 앞뒤 run 사이에서 순서대로 처리하므로, 결과는 질의를 하나씩 처리한 것과 같음
+//
+//	for (i = 0; i < b->count; i = end) {
+//		end = wbatch_RunEnd( b, i);
+//		if (end == i) { ... D 질의 하나 처리 ...; end = i + 1; continue; }
+//		wbatch_Begin( b, i, end);
+//		traverse( dict, callback);		// callback에서 wbatch_Match( b, word, data)
+//		for (j = i; j < end; j++) ... b->queries[j].result ...
+//	}
+
+#define WBATCH_SEARCH	'S'
+#define WBATCH_DELETE	'D'
+
+typedef struct
+{
+	char	op;		// WBATCH_SEARCH or WBATCH_DELETE
+	char	*word;	// '\0'으로 끝남 (파일 내용을 가리킴)
+	int		len;	// 단어의 길이
+	void	*result;// WBATCH_SEARCH: 찾은 데이터 (wbatch_Match가 설정), NULL if not found
+} tQuery;
+
+// merge-join할 질의 (단어순으로 정렬)
+typedef struct
+{
+	char	*word;
+	int		idx;	// queries의 위치
+} tQueryKey;
+
+typedef struct
+{
+	int			count;		// 질의 수
+	tQuery		*queries;	// 파일에 나온 순서
+	char		*text;		// 파일 내용 (단어 사이의 공백을 '\0'으로 바꿈)
+	tQueryKey	*keys;		// 현재 run의 질의 (단어순)
+	int			nkeys;
+	int			cursor;		// 아직 사전 단어와 맞추지 않은 첫 key
+} WBATCH;
+
+////////////////////////////////////////////////////////////////////////////////
+// function declarations
+
+/* Reads a query file
+	return	batch pointer
+			NULL if the file cannot be read, overflow or a malformed query (표준 에러에 출력)
+*/
+WBATCH *wbatch_Load( const char *filename);
+
+/* Recycles memory of the batch
+*/
+void wbatch_Close( WBATCH *b);
+
+/* returns end of the run of search queries starting at start
+	start의 질의가 WBATCH_DELETE이면 start
+*/
+int wbatch_RunEnd( const WBATCH *b, int start);
+
+/* Prepares merge-join of the search queries in [start, end)
+	질의를 단어순으로 정렬하고 result를 NULL로 초기화
+	return	1 if successful
+			0 if overflow
+*/
+int wbatch_Begin( WBATCH *b, int start, int end);
+
+/* Matches one dictionary word (사전의 단어순 순회에서 차례로 호출)
+	word와 같은 단어의 질의에 data를 result로 설정
+*/
+void wbatch_Match( WBATCH *b, const char *word, void *data);
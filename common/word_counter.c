@@ -0,0 +1,119 @@
+#include <stdlib.h> // malloc, realloc, calloc, free
+#include <stdint.h> // uintptr_t
+
+#include "word_key.h"
+#include "tokenizer.h"
+#include "str_arena.h"
+#include "word_counter.h"
+#include "word_sort.h"
+
+#define COUNTER_INIT_SIZE	1024	// 단어 배열의 초기 크기 (2의 거듭제곱, 해시 테이블은 2배)
+
+// 서로 다른 단어의 배열과 그 index의 해시 테이블
+typedef struct
+{
+	tWord	*words;		// 처음 나온 순서의 단어 구조체
+	int		count;		// 단어 수
+	int		capacity;	// words의 크기
+	int		*slots;		// words의 index + 1 (0이면 빈 슬롯), 크기는 capacity * 2
+} tCounter;
+
+// internal function
+// slots에서 인터닝된 word가 있거나 들어갈 슬롯을 찾음 (linear probing)
+static int _slot( const tCounter *c, const char *word){
+	int mask = c->capacity * 2 - 1;
+	int i = (int)(((uintptr_t)word >> 3) * 2654435761u) & mask;
+
+	while (c->slots[i] && c->words[c->slots[i] - 1].word != word)
+		i = (i + 1) & mask;
+	return i;
+}
+
+// internal function
+// words와 slots의 크기를 2배로 늘림
+// return	1 if successful
+//			0 if overflow
+static int _grow( tCounter *c){
+	tWord *words = (tWord *)realloc(c->words, c->capacity * 2 * sizeof(tWord));
+
+	if (words == NULL) return 0;
+	c->words = words;
+
+	free(c->slots);
+	if ((c->slots = (int *)calloc(c->capacity * 4, sizeof(int))) == NULL) return 0;
+	c->capacity *= 2;
+
+	for (int i = 0; i < c->count; i++) c->slots[_slot(c, c->words[i].word)] = i + 1;
+	return 1;
+}
+
+// internal function
+// 입력의 단어를 세어 서로 다른 단어를 c에 모음
+// return	1 if successful
+//			0 if overflow
+static int _count( TOKENIZER *tok, STRARENA *arena, tCounter *c){
+	tToken token;
+
+	c->count = 0;
+	c->capacity = COUNTER_INIT_SIZE;
+	c->words = (tWord *)malloc(c->capacity * sizeof(tWord));
+	c->slots = (int *)calloc(c->capacity * 2, sizeof(int));
+	if (c->words == NULL || c->slots == NULL) return 0;
+
+	while (tok_Next(tok, &token)) {
+		char *word = (char *)strarena_Intern(arena, token.ptr, token.len);
+		int slot;
+
+		if (word == NULL) return 0;
+
+		slot = _slot(c, word);
+		if (c->slots[slot]) {
+			c->words[c->slots[slot] - 1].freq++;
+			continue;
+		}
+
+		if (c->count == c->capacity) {
+			if (!_grow(c)) return 0;
+			slot = _slot(c, word);
+		}
+		c->words[c->count].word = word;
+		c->words[c->count].key = wkey_Make(word, token.len);
+		c->words[c->count].len = token.len;
+		c->words[c->count].freq = 1;
+		c->slots[slot] = ++c->count;
+	}
+	return 1;
+}
+
+/* Counts all words of tok and returns the distinct words sorted by word (strcmp 순서)
+	단어 문자열은 arena에 인터닝하고, 단어 구조체는 하나씩 malloc (free로 하나씩 해제)
+	return	단어 구조체 포인터의 배열 (배열은 free로 해제), *count에 단어 수
+			NULL if overflow (그때까지 할당한 단어 구조체는 해제됨)
+*/
+tWord **wcounter_Sorted( TOKENIZER *tok, STRARENA *arena, int *count){
+	tCounter c = { NULL, 0, 0, NULL };
+	tWord **sorted = NULL;
+	int i = 0;
+
+	// 단어순으로 정렬 (wkey_Compare와 같은 strcmp 순서)
+	if (_count(tok, arena, &c) &&
+		wsort_ByWord(c.words, c.count, sizeof(tWord), offsetof(tWord, word), 0) &&
+		(sorted = (tWord **)malloc((c.count + 1) * sizeof(tWord *))) != NULL) {
+		// 사전에서 하나씩 삭제, 해제하므로 단어 구조체는 따로 할당
+		for (i = 0; i < c.count; i++) {
+			if ((sorted[i] = (tWord *)malloc(sizeof(tWord))) == NULL) break;
+			*sorted[i] = c.words[i];
+		}
+		if (i < c.count) {
+			while (i > 0) free(sorted[--i]);
+			free(sorted);
+			sorted = NULL;
+		}
+	}
+
+	free(c.words);
+	free(c.slots);
+
+	*count = (sorted != NULL) ? c.count : 0;
+	return sorted;
+}
@@ -0,0 +1,29 @@
+////////////////////////////////////////////////////////////////////////////////
+// word counter (사전 생성의 counting pass)
+// 입력의 단어를 모두 센 뒤, 서로 다른 단어의 단어 구조체를 단어순으로 정렬하여 돌려줌
+// 트리 사전은 이 배열로 균형 트리를 바로 연결 (BST_BuildSorted, AVLT_BuildSorted)
+//
+// 같은 단어는 arena에서 같은 포인터로 인터닝되므로, 포인터를 키로 하는 해시 테이블로 빈도를 셈
+// n개의 단어 중 서로 다른 단어가 d개이면 세는 데 O(n), 정렬(wsort_ByWord)에 O(d log d)
+//
+// word_key.h, tokenizer.h, str_arena.h 다음에 include
+
+////////////////////////////////////////////////////////////////////////////////
+// 단어 구조체 (word_count6, word_count7의 사전 데이터)
+typedef struct
+{
+	char		*word;	// 단어 (arena에 인터닝됨)
+	tWordKey	key;	// 단어의 앞 8바이트 (compare_by_word에서 정수 비교로 먼저 사용)
+	int			len;	// 단어의 길이
+	int			freq;	// 빈도
+} tWord;
+
+////////////////////////////////////////////////////////////////////////////////
+// function declarations
+
+/* Counts all words of tok and returns the distinct words sorted by word (strcmp 순서)
+	단어 문자열은 arena에 인터닝하고, 단어 구조체는 하나씩 malloc (free로 하나씩 해제)
+	return	단어 구조체 포인터의 배열 (배열은 free로 해제), *count에 단어 수
+			NULL if overflow (그때까지 할당한 단어 구조체는 해제됨)
+*/
+tWord **wcounter_Sorted( TOKENIZER *tok, STRARENA *arena, int *count);
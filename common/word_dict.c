@@ -0,0 +1,252 @@
+#include <stdlib.h> // malloc, realloc, free
+#include <string.h> // memcpy, memcmp, strcmp
+#include <fcntl.h> // open
+#include <unistd.h> // close
+#include <sys/mman.h> // mmap, munmap
+#include <sys/stat.h> // fstat
+
+#include "word_dict.h"
+#include "outbuf.h"
+
+// internal function
+// 각 영역의 시작 위치 (header 다음부터 차례로)
+static size_t _offsetsPos( void){
+	return sizeof(tWDictHeader);
+}
+
+static size_t _freqsPos( uint64_t count){
+	return _offsetsPos() + (count + 1) * sizeof(uint32_t);
+}
+
+static size_t _blobPos( uint64_t count){
+	return _freqsPos(count) + count * sizeof(uint32_t);
+}
+
+/* Allocates an empty dictionary writer
+	return	writer pointer
+			NULL if overflow
+*/
+WDICT_WRITER *wdict_Create( void){
+	WDICT_WRITER *w = (WDICT_WRITER *)calloc(1, sizeof(WDICT_WRITER));
+
+	if (w == NULL) return NULL;
+
+	w->capacity = 1024;
+	w->offsets = (uint32_t *)malloc((w->capacity + 1) * sizeof(uint32_t));
+	w->freqs = (uint32_t *)malloc(w->capacity * sizeof(uint32_t));
+	w->blob_cap = 64 * 1024;
+	w->blob = (char *)malloc(w->blob_cap);
+
+	if (w->offsets == NULL || w->freqs == NULL || w->blob == NULL) {
+		wdict_Destroy(w);
+		return NULL;
+	}
+	return w;
+}
+
+/* Recycles memory of the writer
+*/
+void wdict_Destroy( WDICT_WRITER *w){
+	if (w == NULL) return;
+
+	free(w->offsets);
+	free(w->freqs);
+	free(w->blob);
+	free(w);
+}
+
+/* Appends a word of len bytes and its frequency
+	단어는 strcmp 순으로 (중복 없이) 추가해야 함
+	return	1 if successful
+			0 if overflow or out of order (이후 wdict_Save는 실패)
+*/
+int wdict_Add( WDICT_WRITER *w, const char *word, size_t len, int freq){
+	if (w->error) return 0;
+
+	// 직전 단어보다 커야 함 (탐색은 이진탐색이므로)
+	if (w->count > 0 && strcmp(w->blob + w->offsets[w->count - 1], word) >= 0) {
+		w->error = 1;
+		return 0;
+	}
+
+	// offsets는 uint32_t이므로 blob은 4GB를 넘을 수 없음
+	if (w->blob_size + len + 1 > UINT32_MAX || w->count == INT32_MAX - 1) {
+		w->error = 1;
+		return 0;
+	}
+
+	if (w->count == w->capacity) {
+		uint32_t *offsets = (uint32_t *)realloc(w->offsets, (w->capacity * 2 + 1) * sizeof(uint32_t));
+		uint32_t *freqs;
+
+		if (offsets != NULL) w->offsets = offsets;
+		freqs = (uint32_t *)realloc(w->freqs, w->capacity * 2 * sizeof(uint32_t));
+		if (freqs != NULL) w->freqs = freqs;
+
+		if (offsets == NULL || freqs == NULL) {
+			w->error = 1;
+			return 0;
+		}
+		w->capacity *= 2;
+	}
+
+	while (w->blob_size + len + 1 > w->blob_cap) {
+		char *blob = (char *)realloc(w->blob, w->blob_cap * 2);
+
+		if (blob == NULL) {
+			w->error = 1;
+			return 0;
+		}
+		w->blob = blob;
+		w->blob_cap *= 2;
+	}
+
+	w->offsets[w->count] = (uint32_t)w->blob_size;
+	w->freqs[w->count] = (uint32_t)freq;
+	memcpy(w->blob + w->blob_size, word, len);
+	w->blob[w->blob_size + len] = '\0';
+	w->blob_size += len + 1;
+	w->total += freq;
+	w->count++;
+
+	return 1;
+}
+
+/* Writes the dictionary to a file
+	return	1 if successful
+			0 if the file cannot be written or wdict_Add failed before
+*/
+int wdict_Save( WDICT_WRITER *w, const char *filename){
+	tWDictHeader header;
+	OUTBUF *out;
+
+	if (w->error) return 0;
+
+	if ((out = out_Create(filename, 0)) == NULL) return 0;
+
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, WDICT_MAGIC, 4);
+	header.version = WDICT_VERSION;
+	header.count = w->count;
+	header.blob_size = w->blob_size;
+	header.total = w->total;
+
+	w->offsets[w->count] = (uint32_t)w->blob_size;
+
+	out_Write(out, (const char *)&header, sizeof(header));
+	out_Write(out, (const char *)w->offsets, (w->count + 1) * sizeof(uint32_t));
+	out_Write(out, (const char *)w->freqs, w->count * sizeof(uint32_t));
+	out_Write(out, w->blob, w->blob_size);
+
+	return out_Close(out);
+}
+
+/* Maps a dictionary file read-only
+	header와 각 영역의 크기만 확인하며, 단어를 읽거나 메모리를 할당하지 않음
+	return	dictionary pointer
+			NULL if the file cannot be opened or is not a dictionary file
+*/
+WDICT *wdict_Open( const char *filename){
+	int fd = open(filename, O_RDONLY);
+	struct stat st;
+	const tWDictHeader *header;
+	WDICT *d;
+	void *map;
+
+	if (fd < 0) return NULL;
+
+	if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode) || (size_t)st.st_size < sizeof(tWDictHeader)) {
+		close(fd);
+		return NULL;
+	}
+
+	map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd); // 매핑은 fd를 닫아도 유지됨
+	if (map == MAP_FAILED) return NULL;
+
+	header = (const tWDictHeader *)map;
+	if (memcmp(header->magic, WDICT_MAGIC, 4) != 0 || header->version != WDICT_VERSION || header->count > INT32_MAX - 1
+		|| header->blob_size > (uint64_t)st.st_size
+		|| _blobPos(header->count) + header->blob_size != (uint64_t)st.st_size) {
+		munmap(map, st.st_size);
+		return NULL;
+	}
+
+	d = (WDICT *)malloc(sizeof(WDICT));
+	if (d == NULL) {
+		munmap(map, st.st_size);
+		return NULL;
+	}
+	d->map = map;
+	d->size = st.st_size;
+	d->count = header->count;
+	d->offsets = (const uint32_t *)((const char *)map + _offsetsPos());
+	d->freqs = (const uint32_t *)((const char *)map + _freqsPos(header->count));
+	d->blob = (const char *)map + _blobPos(header->count);
+	d->blob_size = header->blob_size;
+
+	// 마지막 단어가 '\0'으로 끝나지 않으면 문자열이 파일 밖으로 이어질 수 있음
+	if (d->count > 0 && (d->blob_size == 0 || d->offsets[d->count] != d->blob_size || d->blob[d->blob_size - 1] != '\0')) {
+		wdict_Close(d);
+		return NULL;
+	}
+	return d;
+}
+
+/* Unmaps the dictionary file
+*/
+void wdict_Close( WDICT *d){
+	if (d == NULL) return;
+
+	munmap(d->map, d->size);
+	free(d);
+}
+
+/* returns number of words
+*/
+int wdict_Count( const WDICT *d){
+	return d->count;
+}
+
+/* returns the index-th word in strcmp order ('\0'으로 끝남, wdict_Close 전까지 유효)
+*/
+const char *wdict_Word( const WDICT *d, int index){
+	uint32_t off = d->offsets[index];
+
+	// 손상된 파일에서도 blob 밖을 읽지 않음
+	return off < d->blob_size ? d->blob + off : "";
+}
+
+/* returns length of the index-th word
+*/
+size_t wdict_Len( const WDICT *d, int index){
+	uint32_t start = d->offsets[index];
+	uint32_t end = d->offsets[index + 1];
+
+	return (start < end && end <= d->blob_size) ? end - start - 1 : 0;
+}
+
+/* returns frequency of the index-th word
+*/
+int wdict_Freq( const WDICT *d, int index){
+	return (int)d->freqs[index];
+}
+
+/* Finds a word (binary search)
+	return	index of the word (0 ~ count - 1)
+			-1 if not found
+*/
+int wdict_Search( const WDICT *d, const char *word){
+	int left = 0;
+	int right = d->count - 1;
+
+	while (left <= right) {
+		int mid = (left + right) / 2;
+		int cmp = strcmp(word, wdict_Word(d, mid));
+
+		if (cmp == 0) return mid;
+		if (cmp < 0) right = mid - 1;
+		else left = mid + 1;
+	}
+	return -1;
+}
@@ -0,0 +1,111 @@
+#include <stddef.h> // size_t
+#include <stdint.h> // uint32_t, uint64_t
+
+////////////////////////////////////////////////////////////////////////////////
+// binary dictionary file
+// 완성된 사전(단어순으로 정렬된 단어와 빈도)을 파일로 저장하고, 읽기 전용 mmap으로 다시 사용
+// 파일을 읽을 때 파싱이나 메모리 할당 없이 바로 탐색/출력할 수 있음
+//
+// 파일 구조 (정수는 모두 little-endian, 각 영역은 4바이트 정렬)
+//	header		tWDictHeader (32 bytes)
+//	offsets		uint32_t [count + 1]	i번째 단어의 blob 내 시작 위치, offsets[count] = blob_size
+//	freqs		uint32_t [count]		i번째 단어의 빈도
+//	blob		char [blob_size]		'\0'으로 끝나는 단어들 (strcmp 순)
+
+#define WDICT_MAGIC		"WDIC"
+#define WDICT_VERSION	1
+
+typedef struct
+{
+	char		magic[4];	// WDICT_MAGIC
+	uint32_t	version;	// WDICT_VERSION
+	uint32_t	count;		// 단어 수
+	uint32_t	reserved;
+	uint64_t	blob_size;	// 문자열 영역의 크기
+	uint64_t	total;		// 빈도의 합
+} tWDictHeader;
+
+// 읽기 전용으로 매핑된 사전
+typedef struct
+{
+	void			*map;		// 파일 전체의 매핑
+	size_t			size;		// 파일 크기
+	int				count;		// 단어 수
+	const uint32_t	*offsets;
+	const uint32_t	*freqs;
+	const char		*blob;
+	uint64_t		blob_size;
+} WDICT;
+
+// 저장할 사전 (단어순으로 추가)
+typedef struct
+{
+	int			count;
+	int			capacity;	// offsets, freqs 배열의 용량
+	uint32_t	*offsets;
+	uint32_t	*freqs;
+	char		*blob;
+	size_t		blob_size;
+	size_t		blob_cap;
+	uint64_t	total;
+	int			error;		// 1: 메모리 부족 또는 정렬 순서 위반 (wdict_Save 실패)
+} WDICT_WRITER;
+
+////////////////////////////////////////////////////////////////////////////////
+// function declarations
+
+/* Allocates an empty dictionary writer
+	return	writer pointer
+			NULL if overflow
+*/
+WDICT_WRITER *wdict_Create( void);
+
+/* Recycles memory of the writer
+*/
+void wdict_Destroy( WDICT_WRITER *w);
+
+/* Appends a word of len bytes and its frequency
+	단어는 strcmp 순으로 (중복 없이) 추가해야 함
+	return	1 if successful
+			0 if overflow or out of order (이후 wdict_Save는 실패)
+*/
+int wdict_Add( WDICT_WRITER *w, const char *word, size_t len, int freq);
+
+/* Writes the dictionary to a file
+	return	1 if successful
+			0 if the file cannot be written or wdict_Add failed before
+*/
+int wdict_Save( WDICT_WRITER *w, const char *filename);
+
+/* Maps a dictionary file read-only
+	header와 각 영역의 크기만 확인하며, 단어를 읽거나 메모리를 할당하지 않음
+	return	dictionary pointer
+			NULL if the file cannot be opened or is not a dictionary file
+*/
+WDICT *wdict_Open( const char *filename);
+
+/* Unmaps the dictionary file
+*/
+void wdict_Close( WDICT *d);
+
+/* returns number of words
+*/
+int wdict_Count( const WDICT *d);
+
+/* Finds a word (binary search)
+	return	index of the word (0 ~ count - 1)
+			-1 if not found
+*/
+int wdict_Search( const WDICT *d, const char *word);
+
+/* returns the index-th word in strcmp order ('\0'으로 끝남, wdict_Close 전까지 유효)
+*/
+const char *wdict_Word( const WDICT *d, int index);
+
+/* returns length of the index-th word
+*/
+size_t wdict_Len( const WDICT *d, int index);
+
+/* returns frequency of the index-th word
+*/
+int wdict_Freq( const WDICT *d, int index);
@@ -0,0 +1,44 @@
+#include <stddef.h> // size_t
+#include <stdint.h> // uint64_t
+#include <string.h> // memcmp
+
+////////////////////////////////////////////////////////////////////////////////
+// word prefix key
+// 단어의 앞 8바이트를 big-endian으로 담은 정수 (8바이트보다 짧으면 뒤를 0으로 채움)
+// 두 키의 대소 관계는 앞 8바이트에 대한 strcmp와 같으므로,
+// 단어 구조체에 키와 길이를 함께 저장해 두면 대부분의 비교가 정수 비교 한 번으로 끝남
+// 탐색의 가장 안쪽 루프에서 호출되므로 헤더에 inline으로 정의
+
+typedef uint64_t tWordKey;
+
+/* Makes the prefix key of a word of len bytes
+*/
+static inline tWordKey wkey_Make( const char *word, size_t len)
+{
+	tWordKey key = 0;
+	size_t n = len < 8 ? len : 8;
+
+	if (n == 0) return 0;
+
+	for (size_t i = 0; i < n; i++)
+		key = (key << 8) | (unsigned char)word[i];
+
+	return key << (8 * (8 - n));
+}
+
+/* Compares two words with their prefix keys and lengths
+	return	strcmp(word1, word2)와 같은 부호 (<0, 0, >0)
+*/
+static inline int wkey_Compare( tWordKey key1, const char *word1, size_t len1, tWordKey key2, const char *word2, size_t len2)
+{
+	int cmp;
+
+	if (key1 != key2) return key1 < key2 ? -1 : 1;
+
+	// 앞 8바이트가 같고 한쪽이 8바이트 이하이면 길이로 결정됨
+	if (len1 > 8 && len2 > 8) {
+		cmp = memcmp( word1 + 8, word2 + 8, (len1 < len2 ? len1 : len2) - 8);
+		if (cmp != 0) return cmp;
+	}
+	return (len1 > len2) - (len1 < len2);
+}
@@ -0,0 +1,295 @@
+#include <stdlib.h> // malloc, free, qsort
+#include <string.h> // memcpy, memset
+
+#include "word_sort.h"
+
+#define INSERTION_CUTOFF	16	// 이보다 작은 구간은 삽입 정렬
+#define RADIX_BITS			16	// 빈도 radix pass의 자릿수 (2 pass)
+#define RADIX_SIZE			(1 << RADIX_BITS)
+
+// 정렬 키 (레코드 대신 키 배열을 정렬한 뒤 마지막에 레코드를 한 번만 재배치)
+typedef struct
+{
+	const unsigned char	*word;
+	unsigned int		rank;	// 빈도를 내림차순 정렬용으로 변환한 값
+	int					idx;	// 원래 위치 (같은 키의 순서 유지)
+} tSortKey;
+
+// ASCII 대소문자 변환 테이블 (C locale의 tolower와 같음)
+static unsigned char fold_table[256];
+static int fold_ready = 0;
+
+// internal function
+static void _initFold( void){
+	if (fold_ready) return;
+
+	for (int c = 0; c < 256; c++) {
+		fold_table[c] = (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+	}
+	fold_ready = 1;
+}
+
+// internal function
+// depth 위치의 문자 (WSORT_FOLDCASE이면 소문자로 변환)
+static inline int _charAt( const tSortKey *k, int depth, int fold){
+	int c = k->word[depth];
+	return fold ? fold_table[c] : c;
+}
+
+// internal function
+// depth 위치부터 두 단어를 비교, 같으면 원래 위치로 비교
+static int _compareFrom( const tSortKey *a, const tSortKey *b, int depth, int fold){
+	const unsigned char *s = a->word + depth;
+	const unsigned char *t = b->word + depth;
+
+	if (fold) {
+		while (*s && fold_table[*s] == fold_table[*t]) {
+			s++;
+			t++;
+		}
+		if (fold_table[*s] != fold_table[*t]) return fold_table[*s] - fold_table[*t];
+	}
+	else {
+		while (*s && *s == *t) {
+			s++;
+			t++;
+		}
+		if (*s != *t) return *s - *t;
+	}
+	return a->idx - b->idx;
+}
+
+// internal function
+static void _insertionSort( tSortKey *a, int n, int depth, int fold){
+	for (int i = 1; i < n; i++) {
+		tSortKey key = a[i];
+		int j = i - 1;
+
+		while (j >= 0 && _compareFrom(&a[j], &key, depth, fold) > 0) {
+			a[j + 1] = a[j];
+			j--;
+		}
+		a[j + 1] = key;
+	}
+}
+
+// internal function
+static int _compareIdx( const void *p1, const void *p2){
+	return ((const tSortKey *)p1)->idx - ((const tSortKey *)p2)->idx;
+}
+
+// internal function
+static inline void _swap( tSortKey *a, int i, int j){
+	tSortKey t = a[i];
+	a[i] = a[j];
+	a[j] = t;
+}
+
+// internal function
+// multikey quicksort (Bentley & Sedgewick)
+// depth 이전의 문자는 구간 안에서 모두 같음
+static void _mkqsort( tSortKey *a, int n, int depth, int fold){
+	while (n > 1) {
+		int lt, gt, i, pivot;
+
+		if (n < INSERTION_CUTOFF) {
+			_insertionSort(a, n, depth, fold);
+			return;
+		}
+
+		// median of 3
+		{
+			int x = _charAt(&a[0], depth, fold);
+			int y = _charAt(&a[n / 2], depth, fold);
+			int z = _charAt(&a[n - 1], depth, fold);
+
+			if (x > y) { int t = x; x = y; y = t; }
+			if (y > z) y = z;
+			pivot = (x > y) ? x : y;
+		}
+
+		// 3-way partition: [0, lt) < pivot, [lt, gt] == pivot, (gt, n) > pivot
+		lt = 0;
+		gt = n - 1;
+		i = 0;
+		while (i <= gt) {
+			int c = _charAt(&a[i], depth, fold);
+
+			if (c < pivot) _swap(a, lt++, i++);
+			else if (c > pivot) _swap(a, i, gt--);
+			else i++;
+		}
+
+		_mkqsort(a, lt, depth, fold);
+		_mkqsort(a + gt + 1, n - gt - 1, depth, fold);
+
+		// 가운데 구간은 다음 문자로 계속 정렬
+		if (pivot == 0) {
+			// 문자열이 모두 같음 (대소문자만 다른 경우): 원래 순서대로
+			if (gt - lt > 0) qsort(a + lt, gt - lt + 1, sizeof(tSortKey), _compareIdx);
+			return;
+		}
+		a += lt;
+		n = gt - lt + 1;
+		depth++;
+	}
+}
+
+// internal function
+// rank 오름차순 stable radix sort (16 bit씩 2 pass)
+// return	1 if successful
+//			0 if overflow
+static int _radixByRank( tSortKey *a, int n){
+	tSortKey *tmp;
+	int *count;
+
+	if (n < INSERTION_CUTOFF) {
+		for (int i = 1; i < n; i++) {
+			tSortKey key = a[i];
+			int j = i - 1;
+
+			while (j >= 0 && a[j].rank > key.rank) {
+				a[j + 1] = a[j];
+				j--;
+			}
+			a[j + 1] = key;
+		}
+		return 1;
+	}
+
+	tmp = (tSortKey *)malloc(n * sizeof(tSortKey));
+	count = (int *)malloc(RADIX_SIZE * sizeof(int));
+	if (tmp == NULL || count == NULL) {
+		free(tmp);
+		free(count);
+		return 0;
+	}
+
+	for (int shift = 0; shift < 32; shift += RADIX_BITS) {
+		unsigned int first = (a[0].rank >> shift) & (RADIX_SIZE - 1);
+		int same = 1;
+		int sum = 0;
+
+		memset(count, 0, RADIX_SIZE * sizeof(int));
+		for (int i = 0; i < n; i++) {
+			unsigned int d = (a[i].rank >> shift) & (RADIX_SIZE - 1);
+			count[d]++;
+			if (d != first) same = 0;
+		}
+		if (same) continue; // 모두 같은 자릿값이면 건너뜀 (빈도가 65536 미만이면 상위 pass)
+
+		for (int d = 0; d < RADIX_SIZE; d++) {
+			int c = count[d];
+			count[d] = sum;
+			sum += c;
+		}
+		for (int i = 0; i < n; i++) {
+			tmp[count[(a[i].rank >> shift) & (RADIX_SIZE - 1)]++] = a[i];
+		}
+		memcpy(a, tmp, n * sizeof(tSortKey));
+	}
+
+	free(tmp);
+	free(count);
+	return 1;
+}
+
+// internal function
+// 정렬된 키 순서대로 레코드를 재배치
+// return	1 if successful
+//			0 if overflow
+static int _permute( char *base, int nmemb, size_t size, const tSortKey *keys){
+	char *tmp = (char *)malloc(nmemb * size);
+
+	if (tmp == NULL) return 0;
+
+	for (int i = 0; i < nmemb; i++) {
+		memcpy(tmp + i * size, base + keys[i].idx * size, size);
+	}
+	memcpy(base, tmp, nmemb * size);
+	free(tmp);
+
+	return 1;
+}
+
+// internal function
+static tSortKey *_makeKeys( char *base, int nmemb, size_t size, size_t word_off){
+	tSortKey *keys = (tSortKey *)malloc(nmemb * sizeof(tSortKey));
+
+	if (keys == NULL) return NULL;
+
+	for (int i = 0; i < nmemb; i++) {
+		keys[i].word = *(const unsigned char **)(base + i * size + word_off);
+		keys[i].rank = 0;
+		keys[i].idx = i;
+	}
+	return keys;
+}
+
+/* Sorts records by word (multikey quicksort on the word bytes)
+	return	1 if successful
+			0 if overflow (배열은 바뀌지 않음)
+*/
+int wsort_ByWord( void *base, int nmemb, size_t size, size_t word_off, int flags){
+	int fold = flags & WSORT_FOLDCASE;
+	tSortKey *keys;
+	int ret;
+
+	if (nmemb < 2) return 1;
+
+	_initFold();
+
+	keys = _makeKeys((char *)base, nmemb, size, word_off);
+	if (keys == NULL) return 0;
+
+	_mkqsort(keys, nmemb, 0, fold);
+	ret = _permute((char *)base, nmemb, size, keys);
+
+	free(keys);
+	return ret;
+}
+
+/* Sorts records by frequency (descending), then by word
+	빈도에 대한 radix pass로 같은 빈도끼리 모은 뒤, 각 구간을 단어순으로 정렬
+	return	1 if successful
+			0 if overflow (배열은 바뀌지 않음)
+*/
+int wsort_ByFreq( void *base, int nmemb, size_t size, size_t word_off, size_t freq_off, int flags){
+	int fold = flags & WSORT_FOLDCASE;
+	tSortKey *keys;
+	int start;
+	int ret;
+
+	if (nmemb < 2) return 1;
+
+	_initFold();
+
+	keys = _makeKeys((char *)base, nmemb, size, word_off);
+	if (keys == NULL) return 0;
+
+	// 부호 있는 빈도를 순서가 보존되는 부호 없는 값으로 바꾼 뒤 반전 (내림차순)
+	for (int i = 0; i < nmemb; i++) {
+		int freq = *(const int *)((char *)base + i * size + freq_off);
+		keys[i].rank = ~((unsigned int)freq ^ 0x80000000u);
+	}
+
+	if (!_radixByRank(keys, nmemb)) {
+		free(keys);
+		return 0;
+	}
+
+	// 같은 빈도 구간마다 단어순 정렬
+	// (이미 단어순이면 stable radix pass가 구간 안의 순서를 유지하므로 생략)
+	start = 0;
+	for (int i = 1; i <= nmemb && !(flags & WSORT_PRESORTED); i++) {
+		if (i == nmemb || keys[i].rank != keys[start].rank) {
+			if (i - start > 1) _mkqsort(keys + start, i - start, 0, fold);
+			start = i;
+		}
+	}
+
+	ret = _permute((char *)base, nmemb, size, keys);
+
+	free(keys);
+	return ret;
+}
@@ -0,0 +1,27 @@
+#include <stddef.h> // size_t, offsetof
+
+////////////////////////////////////////////////////////////////////////////////
+// word sort engine
+// qsort처럼 임의의 레코드 배열을 정렬하며, 레코드 안의 단어(char *)와 빈도(int) 위치는
+// offsetof로 전달 (예: offsetof(tWord, word), offsetof(tWord, freq))
+// 같은 키를 가진 레코드는 원래 순서를 유지 (stable)
+
+// flags
+#define WSORT_FOLDCASE	1	// 단어를 대소문자 구분 없이 비교 (strcasecmp 기준), 없으면 strcmp 기준
+#define WSORT_PRESORTED	2	// 레코드가 이미 단어순으로 정렬되어 있음 (wsort_ByFreq는 빈도 pass만 수행)
+
+////////////////////////////////////////////////////////////////////////////////
+// function declarations
+
+/* Sorts records by word (multikey quicksort on the word bytes)
+	return	1 if successful
+			0 if overflow (배열은 바뀌지 않음)
+*/
+int wsort_ByWord( void *base, int nmemb, size_t size, size_t word_off, int flags);
+
+/* Sorts records by frequency (descending), then by word
+	빈도에 대한 radix pass로 같은 빈도끼리 모은 뒤, 각 구간을 단어순으로 정렬
+	return	1 if successful
+			0 if overflow (배열은 바뀌지 않음)
+*/
+int wsort_ByFreq( void *base, int nmemb, size_t size, size_t word_off, size_t freq_off, int flags);
@@ -3,6 +3,8 @@
 #include <stdlib.h>
 #include <assert.h>
 
+#include "outbuf.h"
+
 // 깊이 우선 순회
 void depth_first_Traversal(int *graph, int num_vertex)
 {
@@ -114,15 +116,21 @@ int *load_graph( char *filename, int *num_vertex)
 ////////////////////////////////////////////////////////////////////////////////
 void print_graph( int *graph, int num)
 {
+	OUTBUF *out = out_Stdout();
 	int i, j;
 	
+	fflush( stdout);
 	for (i = 1; i <= num; i++)
 	{
 		for (j = 1; j <= num; j++)
-			printf( "%d\t", *(graph + i * num + j));
+		{
+			out_Int( out, *(graph + i * num + j));
+			out_Char( out, '\t');
+		}
 		
-		printf( "\n");
+		out_Char( out, '\n');
 	}
+	out_Flush( out);
 }
 
 ////////////////////////////////////////////////////////////////////////////////